@@ -0,0 +1,36 @@
+#include "arena.h"
+
+#include <algorithm> // std::max
+#include <cstring>   // std::memcpy
+
+Arena::Arena(size_t size) : blockSize(size) {
+    blocks.push_back({std::make_unique<char[]>(blockSize), blockSize});
+}
+
+void* Arena::allocate(size_t bytes, size_t align) {
+    while (true) {
+        Block& b = blocks[block];
+        const size_t at = (used + align - 1) & ~(align - 1);
+        if (at + bytes <= b.size) {
+            used = at + bytes;
+            return b.bytes.get() + at;
+        }
+        // Move on to the next kept block, or add one big enough
+        if (++block == blocks.size()) {
+            const size_t size = std::max(blockSize, bytes + align);
+            blocks.push_back({std::make_unique<char[]>(size), size});
+        }
+        used = 0;
+    }
+}
+
+std::string_view Arena::copy(std::string_view text) {
+    char* p = allocate<char>(text.size());
+    if (!text.empty()) std::memcpy(p, text.data(), text.size());
+    return {p, text.size()};
+}
+
+void Arena::reset() {
+    block = 0;
+    used = 0;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Bump allocator for memory that only has to last one command. Allocating
+// is a pointer bump; nothing is freed on its own, and reset() hands
+// everything back at once. Blocks are kept across resets, so once a session
+// has seen its largest command, handling another allocates nothing from the
+// heap. Only for types that need no destructor.
+struct Arena {
+    explicit Arena(size_t blockSize = 4096);
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t bytes, size_t align);
+    template <typename T>
+    T* allocate(size_t count) { return static_cast<T*>(allocate(sizeof(T) * count, alignof(T))); }
+    std::string_view copy(std::string_view text);
+
+    // Everything allocated so far becomes free space again
+    void reset();
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> bytes;
+        size_t size = 0;
+    };
+    std::vector<Block> blocks;
+    size_t block = 0; // the one being bumped
+    size_t used = 0;  // bytes of it handed out
+    size_t blockSize;
+};
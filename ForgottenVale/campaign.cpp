@@ -0,0 +1,623 @@
+// The world image of vale.world, written by "vale --bake". Don't edit it by
+// hand; bake the world again after changing it.
+#include "campaign.h"
+
+// Sections in the image are aligned to 8 bytes from its start
+alignas(8) const unsigned char kCampaignImage[] = {
+    0x56, 0x41, 0x4c, 0x45, 0x57, 0x4c, 0x44, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0xec, 0xce, 0x0c, 0x72, 0xd0, 0xf4, 0x53, 0x53,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x98, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x58, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x68, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x26, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x3a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+    0x52, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+    0x71, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x84, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+    0x9b, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
+    0xb5, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+    0xd2, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00,
+    0xea, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x04, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
+    0x22, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x31, 0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00,
+    0x42, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00,
+    0x6a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x62, 0x72,
+    0x61, 0x6e, 0x63, 0x68, 0x6f, 0x61, 0x6b, 0x61, 0x6c, 0x74, 0x61, 0x72, 0x62, 0x72, 0x6f, 0x6f,
+    0x6b, 0x72, 0x65, 0x73, 0x74, 0x6e, 0x6f, 0x72, 0x74, 0x68, 0x65, 0x61, 0x73, 0x74, 0x73, 0x6f,
+    0x75, 0x74, 0x68, 0x77, 0x65, 0x73, 0x74, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x62, 0x72, 0x69, 0x64,
+    0x67, 0x65, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x66, 0x69, 0x73, 0x68, 0x64, 0x72, 0x69, 0x6e,
+    0x6b, 0x72, 0x75, 0x73, 0x74, 0x79, 0x20, 0x6b, 0x65, 0x79, 0x6d, 0x61, 0x72, 0x6b, 0x69, 0x6e,
+    0x67, 0x73, 0x73, 0x74, 0x61, 0x6c, 0x61, 0x63, 0x74, 0x69, 0x74, 0x65, 0x73, 0x74, 0x75, 0x6e,
+    0x6e, 0x65, 0x6c, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x68, 0x65, 0x72, 0x62, 0x73, 0x66, 0x6c,
+    0x6f, 0x77, 0x65, 0x72, 0x73, 0x6c, 0x6f, 0x67, 0x62, 0x65, 0x65, 0x73, 0x67, 0x61, 0x74, 0x68,
+    0x65, 0x72, 0x6d, 0x61, 0x70, 0x63, 0x61, 0x69, 0x72, 0x6e, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x61,
+    0x69, 0x6e, 0x73, 0x76, 0x61, 0x6c, 0x65, 0x63, 0x6c, 0x69, 0x6d, 0x62, 0x61, 0x6e, 0x63, 0x69,
+    0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x69, 0x6e, 0x63, 0x6c, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x65, 0x61, 0x72, 0x63, 0x68, 0x77, 0x61, 0x79, 0x66, 0x69, 0x72, 0x65, 0x73, 0x69,
+    0x6c, 0x76, 0x65, 0x72, 0x20, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x74, 0x61, 0x69, 0x72, 0x73,
+    0x64, 0x6f, 0x6f, 0x72, 0x69, 0x76, 0x79, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x64, 0x6f,
+    0x6f, 0x72, 0x75, 0x70, 0x67, 0x6f, 0x6c, 0x64, 0x65, 0x6e, 0x20, 0x63, 0x68, 0x61, 0x6c, 0x69,
+    0x63, 0x65, 0x63, 0x68, 0x65, 0x73, 0x74, 0x6d, 0x75, 0x72, 0x61, 0x6c, 0x62, 0x6f, 0x6e, 0x65,
+    0x73, 0x64, 0x6f, 0x77, 0x6e, 0x61, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x72, 0x6f,
+    0x77, 0x6e, 0x70, 0x65, 0x64, 0x65, 0x73, 0x74, 0x61, 0x6c, 0x68, 0x65, 0x72, 0x6d, 0x69, 0x74,
+    0x74, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x6c, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x74,
+    0x6f, 0x72, 0x63, 0x68, 0x20, 0x71, 0x75, 0x65, 0x73, 0x74, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+    0x6f, 0x72, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x74, 0x6f, 0x72, 0x63, 0x68, 0x6f,
+    0x72, 0x6e, 0x61, 0x74, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x64, 0x6f,
+    0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc9, 0x08, 0x46, 0x6f, 0x72, 0x65,
+    0x73, 0x74, 0x20, 0xc3, 0x4a, 0x84, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x69, 0x6e, 0x20, 0x61, 0xf0, 0x09, 0x20, 0xc9, 0x2c, 0x20, 0x65, 0x6e, 0x63, 0x69, 0x72,
+    0x63, 0x6c, 0x65, 0x64, 0xd9, 0x8f, 0x20, 0x6f, 0x61, 0x6b, 0x73, 0x20, 0x77, 0x68, 0x6f, 0x73,
+    0x65, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x65, 0x73, 0x20, 0x77, 0x65, 0x61, 0x76, 0x65,
+    0x20, 0x61, 0x20, 0x6c, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x6f, 0x6f, 0x66, 0x2e, 0x01,
+    0xc3, 0x20, 0x86, 0x8f, 0x20, 0x6f, 0x61, 0x6b, 0xbf, 0x20, 0x65, 0x74, 0x63, 0x68, 0x65, 0x64,
+    0x8b, 0x20, 0x77, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x65, 0x64, 0x20, 0x72, 0x75, 0x6e, 0x65,
+    0x73, 0x2e, 0x2d, 0x41, 0x20, 0x6d, 0x6f, 0x73, 0x73, 0x2d, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65,
+    0x64, 0x20, 0x61, 0x6c, 0x74, 0x61, 0x72, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x74,
+    0xf0, 0x25, 0x2d, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x77, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70, 0x2e,
+    0x21, 0x41, 0xe1, 0x20, 0x62, 0x72, 0x6f, 0x6f, 0x6b, 0x20, 0x74, 0x72, 0x69, 0x63, 0x6b, 0x6c,
+    0x65, 0x73, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x80, 0x20, 0x72, 0x6f, 0x6f, 0x74,
+    0x73, 0x2e, 0x2a, 0x84, 0x20, 0x72, 0x65, 0x73, 0x74, 0xb7, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x6d,
+    0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0xa2, 0x80,
+    0x20, 0x77, 0x68, 0x69, 0x73, 0x70, 0x65, 0x72, 0x69, 0x6e, 0x67, 0xde, 0x2e, 0x01, 0x9a, 0x09,
+    0x43, 0x72, 0x79, 0x73, 0x74, 0x61, 0x6c, 0x20, 0xc4, 0x46, 0x41, 0x20, 0x67, 0x65, 0x6e, 0x74,
+    0x6c, 0x65, 0xb0, 0x20, 0x6d, 0x75, 0x72, 0x6d, 0x75, 0x72, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65,
+    0x2c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x77, 0x61, 0x74, 0x65, 0x72, 0x73, 0x20, 0x63, 0x6c, 0x65,
+    0x61, 0x72, 0x20, 0x61, 0x73, 0x20, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x82, 0xf0, 0x21, 0x20, 0x61,
+    0x73, 0x20, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x73, 0x6e, 0x6f, 0x77, 0x2e,
+    0x01, 0xc4, 0x20, 0x52, 0x65, 0x6d, 0x6e, 0x61, 0x6e, 0x74, 0x73, 0x89, 0x20, 0x61, 0xea, 0x20,
+    0x62, 0x72, 0x69, 0x64, 0x67, 0x65, 0x20, 0x6a, 0x75, 0x74, 0x98, 0x80, 0x20, 0x62, 0x61, 0x6e,
+    0x6b, 0x73, 0x2e, 0x1f, 0x46, 0x6c, 0x61, 0x74, 0xe7, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61,
+    0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69, 0x6e, 0x67, 0xb7, 0x80, 0x20, 0x6e, 0x69, 0x6d, 0x62,
+    0x6c, 0x65, 0x2e, 0x27, 0x53, 0x69, 0x6c, 0x76, 0x65, 0x72, 0x20, 0x66, 0x69, 0x73, 0x68, 0x20,
+    0x64, 0x61, 0x72, 0x74, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x6e, 0x65, 0x61, 0x74,
+    0x68, 0x80, 0x20, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x15, 0x84, 0x20, 0x64, 0x72,
+    0x69, 0x6e, 0x6b, 0x80, 0x20, 0x63, 0x6f, 0x6f, 0x6c, 0xb0, 0x20, 0x77, 0x61, 0x74, 0x65, 0x72,
+    0x2e, 0x01, 0xba, 0x09, 0x53, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x79, 0x20, 0xec, 0x3b, 0x86, 0xf0,
+    0x20, 0x20, 0x6d, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x67, 0x61, 0x70, 0x65, 0x73, 0xf0, 0x24, 0x20,
+    0x61, 0x20, 0x77, 0x6f, 0x75, 0x6e, 0x64, 0xa1, 0x80, 0x20, 0x68, 0x69, 0x6c, 0x6c, 0x73, 0x69,
+    0x64, 0x65, 0x2c, 0x20, 0x62, 0x72, 0x65, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0xbe, 0x20, 0x61,
+    0x69, 0x72, 0x20, 0x75, 0x70, 0x6f, 0x6e, 0xb9, 0x2e, 0x01, 0xec, 0x17, 0x46, 0x61, 0x64, 0x65,
+    0x64, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x73, 0xe5, 0xd7, 0x80, 0xbe, 0x20, 0x72, 0x6f,
+    0x63, 0x6b, 0x2e, 0x1f, 0x53, 0x68, 0x61, 0x72, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x64, 0x72, 0x69, 0x70, 0x20, 0x73, 0x6c, 0x6f, 0x77, 0x6c, 0x79,
+    0x98, 0xaf, 0x2e, 0x1d, 0x41, 0xe1, 0xe8, 0x20, 0x64, 0x69, 0x73, 0x61, 0x70, 0x70, 0x65, 0x61,
+    0x72, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x64, 0x61, 0x72, 0x6b, 0x6e, 0x65, 0x73, 0x73,
+    0x2e, 0x20, 0x84, 0xf0, 0x23, 0x20, 0x73, 0x74, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x6d, 0x61,
+    0x72, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x6f, 0x6e, 0x80, 0xbe, 0x20, 0x77, 0x61, 0x6c, 0x6c,
+    0x73, 0x2e, 0x01, 0x9e, 0x07, 0x53, 0x75, 0x6e, 0x6e, 0x79, 0x20, 0xb3, 0x30, 0x47, 0x72, 0x61,
+    0x73, 0x73, 0x65, 0x73, 0x20, 0x73, 0x77, 0x61, 0x79, 0xa1, 0x20, 0x61, 0xe0, 0x20, 0x61, 0x6c,
+    0x69, 0x76, 0x65, 0x8b, 0x20, 0x69, 0x6e, 0x73, 0x65, 0x63, 0x74, 0x73, 0x82, 0x20, 0x64, 0x72,
+    0x69, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x65, 0x64, 0x73, 0x2e, 0x01, 0xb3, 0x22,
+    0x57, 0x69, 0x6c, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x6f, 0x6d, 0x73, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+    0x75, 0x72, 0x80, 0xe0, 0xf0, 0x24, 0x20, 0x61, 0x20, 0x74, 0x61, 0x70, 0x65, 0x73, 0x74, 0x72,
+    0x79, 0x2e, 0x24, 0x41, 0x20, 0x66, 0x61, 0x6c, 0x6c, 0x65, 0x6e, 0x20, 0x6c, 0x6f, 0x67, 0x20,
+    0x68, 0x6f, 0x73, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 0x65, 0x73, 0x89, 0xd8,
+    0x20, 0x66, 0x75, 0x6e, 0x67, 0x69, 0x2e, 0x15, 0x42, 0x65, 0x65, 0x73, 0x20, 0x66, 0x6c, 0x69,
+    0x74, 0x20, 0x62, 0x75, 0x73, 0x69, 0x6c, 0x79, 0x98, 0xa6, 0xa2, 0xa6, 0x2e, 0x29, 0x84, 0x20,
+    0x67, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x66, 0x75, 0x6c,
+    0x89, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x66, 0x75, 0x6c, 0x20, 0x77, 0x69, 0x6c, 0x64, 0x66,
+    0x6c, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x2e, 0x04, 0x68, 0x69, 0x6c, 0x6c, 0x08, 0x47, 0x72, 0x61,
+    0x73, 0x73, 0x79, 0x20, 0xed, 0x31, 0x46, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+    0x72, 0x69, 0x73, 0x65, 0x80, 0xae, 0x20, 0x66, 0x6f, 0x72, 0x65, 0x73, 0x74, 0x20, 0x72, 0x6f,
+    0x6c, 0x6c, 0x73, 0x20, 0x61, 0x77, 0x61, 0x79, 0xa1, 0x20, 0x77, 0x61, 0x76, 0x65, 0x73, 0x89,
+    0x20, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x2e, 0x01, 0xed, 0x14, 0x41, 0xf0, 0x0c, 0x20, 0x63, 0x61,
+    0x69, 0x72, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0xf0, 0x26, 0x8a, 0xb8, 0x2e, 0x21, 0x44,
+    0x69, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x65, 0x61, 0x6b, 0x73, 0x20, 0x6c, 0x6f, 0x6f,
+    0x6d, 0x2c, 0x20, 0x76, 0x65, 0x69, 0x6c, 0x65, 0x64, 0xd9, 0x20, 0x6d, 0x69, 0x73, 0x74, 0x2e,
+    0x1c, 0x86, 0xa9, 0x20, 0x73, 0x74, 0x72, 0x65, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6f, 0x75,
+    0x74, 0xa1, 0xf0, 0x09, 0x20, 0x6d, 0x61, 0x6a, 0x65, 0x73, 0x74, 0x79, 0x2e, 0x20, 0x46, 0x72,
+    0x6f, 0x6d, 0x80, 0x20, 0x68, 0x69, 0x6c, 0x6c, 0x74, 0x6f, 0x70, 0xb9, 0x20, 0x67, 0x6c, 0x69,
+    0x6d, 0x70, 0x73, 0x65, 0x80, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x72, 0x65, 0xa9, 0x2e, 0x01, 0xca,
+    0x03, 0xeb, 0x20, 0xc5, 0x28, 0xc2, 0xe7, 0x20, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x89, 0x20, 0x61,
+    0x8a, 0x20, 0x73, 0x65, 0x74, 0x74, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x77, 0x61,
+    0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0xd9, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x01, 0xc5, 0x1a,
+    0x41, 0x20, 0x68, 0x65, 0x61, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x65, 0xd2, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x80, 0xe4, 0x2e, 0x1f, 0x41, 0x20, 0x63, 0x6f, 0x6c,
+    0x6c, 0x61, 0x70, 0x73, 0x65, 0x64, 0xf0, 0x1f, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x80,
+    0x20, 0x67, 0x72, 0x65, 0x79, 0x20, 0x73, 0x6b, 0x79, 0x2e, 0x29, 0x41, 0xf0, 0x0c, 0x20, 0x68,
+    0x65, 0x61, 0x72, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73, 0x6f, 0x6d, 0x65,
+    0x6f, 0x6e, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x63, 0x61, 0x6d,
+    0x70, 0x65, 0x64, 0x2e, 0x26, 0x84, 0x20, 0x73, 0x69, 0x66, 0x74, 0x20, 0x74, 0x68, 0x72, 0x6f,
+    0x75, 0x67, 0x68, 0x80, 0xe4, 0x20, 0x62, 0x75, 0x74, 0xf0, 0x23, 0x20, 0x6e, 0x6f, 0x74, 0x68,
+    0x69, 0x6e, 0x67, 0x89, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x01, 0x92, 0x0b, 0x41, 0x62,
+    0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x20, 0xc6, 0x2e, 0x41, 0x20, 0x6c, 0x6f, 0x6e, 0x65,
+    0x6c, 0x79, 0xb2, 0x20, 0x6c, 0x65, 0x61, 0x6e, 0x73, 0x20, 0x74, 0x6f, 0x77, 0x61, 0x72, 0x64,
+    0x73, 0x80, 0x20, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x73, 0x2c, 0x20, 0x69, 0x74, 0x73, 0x83, 0x20,
+    0x62, 0x61, 0x72, 0x72, 0x65, 0x64, 0xaf, 0x2e, 0x01, 0xc6, 0x12, 0xc2, 0xe6, 0xe5, 0x20, 0x75,
+    0x70, 0x77, 0x61, 0x72, 0x64, 0x73, 0x82, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x2e, 0x13, 0x41, 0xf0,
+    0x06, 0xea, 0x83, 0x20, 0x62, 0x61, 0x72, 0x73, 0x80, 0x20, 0x77, 0x61, 0x79, 0x20, 0x75, 0x70,
+    0x2e, 0x1f, 0x54, 0x68, 0x69, 0x63, 0x6b, 0x20, 0x69, 0x76, 0x79, 0x20, 0x63, 0x6c, 0x69, 0x6e,
+    0x67, 0x73, 0x20, 0x73, 0x74, 0x75, 0x62, 0x62, 0x6f, 0x72, 0x6e, 0x6c, 0x79, 0xa2, 0x80, 0xb1,
+    0x2e, 0x2b, 0x84, 0x20, 0x63, 0x6c, 0x69, 0x6d, 0x62, 0x80, 0x20, 0x63, 0x72, 0x75, 0x6d, 0x62,
+    0x6c, 0x69, 0x6e, 0x67, 0xe6, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+    0x6c, 0x65, 0x61, 0x64, 0x20, 0x6e, 0x6f, 0x77, 0x68, 0x65, 0x72, 0x65, 0x2e, 0x02, 0xf0, 0x33,
+    0x08, 0x48, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0xc7, 0x19, 0x41, 0x20, 0x73, 0x65, 0x63, 0x72,
+    0x65, 0x74, 0xcd, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x8b, 0xf0, 0x22, 0x82, 0xe3, 0xf0,
+    0x25, 0xe9, 0x2e, 0x01, 0xc7, 0x28, 0x41, 0x6e, 0x20, 0x69, 0x72, 0x6f, 0x6e, 0x2d, 0x62, 0x6f,
+    0x75, 0x6e, 0x64, 0x20, 0x63, 0x68, 0x65, 0x73, 0x74, 0xf0, 0x0a, 0x20, 0x61, 0x67, 0x61, 0x69,
+    0x6e, 0x73, 0x74, 0x80, 0x20, 0x66, 0x61, 0x72, 0x20, 0x77, 0x61, 0x6c, 0x6c, 0x2e, 0x20, 0x41,
+    0xf0, 0x05, 0x20, 0x6d, 0x75, 0x72, 0x61, 0x6c, 0x20, 0x64, 0x65, 0x70, 0x69, 0x63, 0x74, 0x73,
+    0x20, 0x61, 0x8a, 0x20, 0x63, 0x6f, 0x72, 0x6f, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20,
+    0x4f, 0x6c, 0x64, 0x20, 0x62, 0x6f, 0x6e, 0x65, 0x73, 0x20, 0x6c, 0x69, 0x65, 0x20, 0x73, 0x63,
+    0x61, 0x74, 0x74, 0x65, 0x72, 0x65, 0x64, 0xd7, 0x80, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x2e,
+    0x01, 0xad, 0x03, 0xeb, 0x20, 0xaa, 0x1e, 0x53, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0xf0, 0x1f, 0xaf,
+    0x20, 0x61, 0xcd, 0x20, 0x73, 0x74, 0x65, 0x65, 0x70, 0x65, 0x64, 0xa1, 0x20, 0x73, 0x69, 0x6c,
+    0x65, 0x6e, 0x63, 0x65, 0x2e, 0x01, 0xaa, 0x1b, 0x55, 0x70, 0x6f, 0x6e, 0x80, 0xb1, 0x20, 0x70,
+    0x65, 0x64, 0x65, 0x73, 0x74, 0x61, 0x6c, 0xf0, 0x0a, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6e, 0x61,
+    0x6c, 0x99, 0x2e, 0x14, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0xaa, 0x5d, 0x16, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x15,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x5b, 0xc7, 0x5d, 0x16, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x14, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0xc6,
+    0x5d, 0x16, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x13, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0xc4, 0x5d, 0x16, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7c, 0x12, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0xed, 0x5d, 0x2d, 0x2d, 0x5b, 0xc3,
+    0x5d, 0x2d, 0x2d, 0x5b, 0xec, 0x5d, 0x16, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x18, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0xb3,
+    0x5d, 0x2d, 0x2d, 0x5b, 0xc5, 0x5d, 0x01, 0xc9, 0x08, 0x6c, 0x6f, 0x77, 0x6c, 0x61, 0x6e, 0x64,
+    0x73, 0x01, 0x9a, 0x01, 0xba, 0x01, 0x9e, 0x04, 0x68, 0x69, 0x6c, 0x6c, 0x01, 0xca, 0x01, 0x92,
+    0x01, 0x92, 0x02, 0xf0, 0x33, 0x01, 0xad, 0x14, 0x41, 0x6e, 0xe2, 0xdc, 0x20, 0x73, 0x6d, 0x69,
+    0x6c, 0x65, 0x73, 0x20, 0x66, 0x61, 0x69, 0x6e, 0x74, 0x6c, 0x79, 0x2e, 0x09, 0x57, 0x68, 0x6f,
+    0x20, 0x61, 0x72, 0x65, 0xb9, 0x3f, 0x1f, 0x4a, 0x75, 0x73, 0x74, 0x20, 0x61, 0x20, 0x77, 0x61,
+    0x6e, 0x64, 0x65, 0x72, 0x65, 0x72, 0x20, 0x77, 0x68, 0x6f, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x73, 0xa2, 0x80, 0xa9, 0x2e, 0x0e, 0x4b, 0x6e, 0x6f, 0x77, 0xbd, 0x20, 0x61, 0x62, 0x6f,
+    0x75, 0x74, 0x80, 0xb2, 0x3f, 0x21, 0x49, 0x74, 0x73, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x20,
+    0x72, 0x6f, 0x6f, 0x6d, 0x20, 0x68, 0x69, 0x64, 0x65, 0x73, 0x99, 0x20, 0x62, 0x65, 0x68, 0x69,
+    0x6e, 0x64, 0x20, 0x61, 0xdf, 0x83, 0x2e, 0x01, 0xa3, 0x15, 0x86, 0xdc, 0x20, 0x6e, 0x6f, 0x64,
+    0x73, 0x82, 0xd0, 0xa2, 0xdd, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x74, 0x73, 0x2e, 0x14,
+    0x41, 0x20, 0x77, 0x65, 0x61, 0x72, 0x79, 0xb8, 0x20, 0x64, 0x6f, 0x66, 0x66, 0x73, 0xdd, 0x20,
+    0x63, 0x61, 0x70, 0x2e, 0x09, 0x41, 0x6e, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x73, 0x3f, 0x1e, 0x4f,
+    0x6e, 0x6c, 0x79, 0x20, 0x77, 0x68, 0x69, 0x73, 0x70, 0x65, 0x72, 0x73, 0x89, 0x20, 0x67, 0x68,
+    0x6f, 0x73, 0x74, 0x73, 0x20, 0x6e, 0x65, 0x61, 0x72, 0x80, 0x20, 0xca, 0x2e, 0x0a, 0x53, 0x65,
+    0x65, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x99, 0x3f, 0x14, 0x52, 0x75, 0x6d, 0x6f, 0x75, 0x72, 0x20,
+    0x73, 0x70, 0x65, 0x61, 0x6b, 0x73, 0x89, 0xe3, 0xdf, 0xa1, 0x80, 0xb2, 0x2e, 0x01, 0xa3, 0x16,
+    0x48, 0x65, 0x20, 0x77, 0x69, 0x73, 0x68, 0x65, 0x73, 0xb9, 0x20, 0x73, 0x61, 0x66, 0x65, 0x20,
+    0x72, 0x6f, 0x61, 0x64, 0x73, 0x2e, 0x12, 0x41, 0x20, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x72,
+    0x61, 0x6e, 0x67, 0x65, 0x72, 0xd2, 0x80, 0xa9, 0x2e, 0x13, 0x48, 0x6f, 0x77, 0x20, 0x6d, 0x61,
+    0x79, 0x20, 0x49, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x80, 0x20, 0xad, 0x3f, 0x38, 0x43, 0x72,
+    0x61, 0x66, 0x74, 0x20, 0x61, 0x91, 0xd9, 0x20, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x69, 0x6e,
+    0x67, 0x20, 0x61, 0x93, 0x82, 0x9c, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x73, 0x65, 0x61,
+    0x72, 0x63, 0x68, 0x80, 0xf0, 0x20, 0x27, 0x73, 0xe8, 0x2e, 0x20, 0x86, 0x94, 0x85, 0x20, 0x61,
+    0x77, 0x61, 0x69, 0x74, 0x73, 0x2e, 0x01, 0xa3, 0x13, 0x48, 0x65, 0xd0, 0xa2, 0xdd, 0x20, 0x73,
+    0x69, 0x6c, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x69, 0x67, 0x69, 0x6c, 0x2e, 0x0b, 0x84, 0x20, 0x63,
+    0x72, 0x61, 0x66, 0x74, 0x20, 0x61, 0x91, 0x2e, 0x1c, 0x41, 0x20, 0x64, 0x65, 0x6c, 0x69, 0x63,
+    0x61, 0x74, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x64, 0x66, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x8b, 0x20,
+    0x61, 0xc0, 0xf0, 0x0b, 0x2e, 0x15, 0x84, 0x20, 0x69, 0x6e, 0x68, 0x61, 0x6c, 0x65, 0x80, 0x20,
+    0x73, 0x77, 0x65, 0x65, 0x74, 0xf0, 0x0b, 0x89, 0x80, 0xa6, 0x2e, 0x0b, 0x41, 0x20, 0x73, 0x6d,
+    0x6f, 0x6f, 0x74, 0x68, 0xb0, 0xb1, 0x2e, 0x1e, 0x50, 0x65, 0x72, 0x68, 0x61, 0x70, 0x73, 0x20,
+    0x69, 0x74, 0x20, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x74,
+    0x68, 0x69, 0x6e, 0x67, 0x8f, 0x2e, 0x13, 0x86, 0xe2, 0x85, 0x20, 0x66, 0x65, 0x65, 0x6c, 0x73,
+    0xf0, 0x21, 0xa1, 0xc1, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x2e, 0x1c, 0x42, 0x75, 0x6e, 0x64, 0x6c,
+    0x65, 0x73, 0x89, 0x20, 0x66, 0x72, 0x61, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x20, 0x68, 0x65, 0x61,
+    0x6c, 0x69, 0x6e, 0x67, 0xf0, 0x07, 0x2e, 0x25, 0x43, 0x68, 0x65, 0x77, 0x69, 0x6e, 0x67, 0x80,
+    0xf0, 0x07, 0xde, 0x20, 0x61, 0xc0, 0x20, 0x74, 0x61, 0x73, 0x74, 0x65, 0x82, 0x20, 0x6c, 0x69,
+    0x66, 0x74, 0x73, 0xc1, 0x20, 0x73, 0x70, 0x69, 0x72, 0x69, 0x74, 0x73, 0x2e, 0x1c, 0x41, 0x20,
+    0x73, 0x74, 0x75, 0x72, 0x64, 0x79, 0x93, 0x2c, 0x20, 0x64, 0x72, 0x79, 0x82, 0x20, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0xa2, 0x20, 0x62, 0x75, 0x72, 0x6e, 0x2e, 0x23, 0x84, 0x20, 0x73, 0x77, 0x69,
+    0x6e, 0x67, 0x80, 0x93, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x66,
+    0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0xe9, 0x20, 0x66, 0x6f, 0x65, 0x73, 0x2e, 0x1b, 0x41,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x70, 0x89, 0x9c, 0x20, 0x74, 0x6f, 0x72, 0x6e, 0x98, 0xf0, 0x26,
+    0xe2, 0x20, 0x67, 0x61, 0x72, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x10, 0x84, 0x20, 0x66, 0x6f, 0x6c,
+    0x64, 0x80, 0x9c, 0x20, 0x6e, 0x65, 0x61, 0x74, 0x6c, 0x79, 0x2e, 0x11, 0x41, 0x20, 0x6d, 0x61,
+    0x6b, 0x65, 0x73, 0x68, 0x69, 0x66, 0x74, 0x91, 0x89, 0x93, 0x82, 0x9c, 0x2e, 0x2d, 0x86, 0x91,
+    0x20, 0x63, 0x72, 0x61, 0x63, 0x6b, 0x6c, 0x65, 0x73, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x6c, 0x79,
+    0x2c, 0x20, 0x63, 0x61, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6c, 0x69, 0x63, 0x6b, 0x65,
+    0x72, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x22, 0x49, 0x6e, 0x74, 0x72,
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x6c, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x64, 0x82, 0x20,
+    0x73, 0x75, 0x72, 0x70, 0x72, 0x69, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x79, 0xd8, 0x2e, 0x14, 0x86,
+    0x94, 0x85, 0x20, 0x67, 0x6c, 0x69, 0x6e, 0x74, 0x73, 0x8b, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x69,
+    0x73, 0x65, 0x2e, 0x0d, 0x41, 0xf0, 0x05, 0x20, 0x6d, 0x61, 0x70, 0x89, 0x80, 0xae, 0xf0, 0x08,
+    0x2e, 0x1b, 0x54, 0x69, 0x6d, 0x65, 0x2d, 0x77, 0x6f, 0x72, 0x6e, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6e, 0x63, 0x79, 0x98, 0x20, 0x61, 0x8a, 0x20, 0x65, 0x72, 0x61, 0x2e, 0x1c, 0x84, 0x20,
+    0x66, 0x6c, 0x69, 0x70, 0x80, 0x8f, 0x20, 0x63, 0x6f, 0x69, 0x6e, 0x2e, 0x20, 0x49, 0x74, 0xf0,
+    0x08, 0x20, 0x68, 0x65, 0x61, 0x64, 0x20, 0x75, 0x70, 0x2e, 0x1c, 0x53, 0x74, 0x69, 0x6c, 0x6c,
+    0x20, 0x73, 0x68, 0x61, 0x72, 0x70, 0xce, 0x20, 0x79, 0x65, 0x61, 0x72, 0x73, 0x89, 0x20, 0x6e,
+    0x65, 0x67, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x23, 0x84, 0x20, 0x70, 0x72, 0x61, 0x63, 0x74, 0x69,
+    0x63, 0x65, 0x20, 0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x63, 0x61, 0x75, 0x74, 0x69, 0x6f, 0x75,
+    0x73, 0xa8, 0x8b, 0x80, 0x20, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e, 0x1c, 0x4a, 0x65, 0x77, 0x65,
+    0x6c, 0x65, 0x64, 0x82, 0xf0, 0x06, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x67, 0x6c, 0x69, 0x74, 0x74,
+    0x65, 0x72, 0x73, 0xce, 0x80, 0xf0, 0x22, 0x2e, 0x27, 0x84, 0x20, 0x61, 0x64, 0x6d, 0x69, 0x72,
+    0x65, 0xc1, 0x20, 0x72, 0x65, 0x66, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0xa1, 0x80, 0x20,
+    0x63, 0x68, 0x61, 0x6c, 0x69, 0x63, 0x65, 0x27, 0x73, 0x20, 0x67, 0x6c, 0x65, 0x61, 0x6d, 0x2e,
+    0x20, 0x57, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x74, 0x89, 0x20, 0x73, 0x69, 0x6c, 0x76, 0x65, 0x72,
+    0x82, 0x20, 0x73, 0x65, 0x74, 0x8b, 0x20, 0x64, 0x75, 0x6c, 0x6c, 0x20, 0x67, 0x65, 0x6d, 0x73,
+    0x2e, 0x2f, 0x84, 0x20, 0x62, 0x72, 0x69, 0x65, 0x66, 0x6c, 0x79, 0x20, 0x63, 0x72, 0x6f, 0x77,
+    0x6e, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x66, 0x65, 0x65, 0x6c,
+    0x69, 0x6e, 0x67, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x64,
+    0x2e, 0x28, 0x59, 0x6f, 0x75, 0x72, 0x91, 0x20, 0x72, 0x65, 0x76, 0x65, 0x61, 0x6c, 0x73, 0x20,
+    0x61, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x20, 0x6e, 0x69, 0x63, 0x68, 0x65, 0x20, 0x68,
+    0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x85, 0x2e, 0x14, 0x49, 0x74, 0x27, 0x73, 0x20,
+    0x74, 0x6f, 0x6f, 0x20, 0x64, 0x61, 0x72, 0x6b, 0xa2, 0x20, 0x73, 0x65, 0x65, 0xbd, 0x2e, 0x06,
+    0x86, 0x83, 0xbf, 0x8e, 0x90, 0x2e, 0x06, 0x86, 0x83, 0xbf, 0x8e, 0x90, 0x2e, 0x0a, 0x86, 0x85,
+    0xf0, 0x0d, 0x82, 0x80, 0x83, 0xdb, 0x90, 0x2e, 0x0a, 0x86, 0x85, 0xf0, 0x0d, 0x82, 0x80, 0x83,
+    0xdb, 0x90, 0x2e, 0x09, 0x84, 0xa7, 0x20, 0x61, 0x85, 0xb7, 0xf0, 0x27, 0x2e, 0x09, 0x84, 0xa7,
+    0x20, 0x61, 0x85, 0xb7, 0xf0, 0x27, 0x2e, 0x06, 0x86, 0x83, 0xbf, 0x8e, 0x90, 0x2e, 0x06, 0x86,
+    0x83, 0xbf, 0x8e, 0x90, 0x2e, 0x0c, 0x86, 0x94, 0x85, 0xda, 0x82, 0x80, 0xcf, 0x83, 0xa8, 0xf0,
+    0x28, 0x2e, 0x0c, 0x86, 0x94, 0x85, 0xda, 0x82, 0x80, 0xcf, 0x83, 0xa8, 0xf0, 0x28, 0x2e, 0x07,
+    0x84, 0xa7, 0x20, 0x61, 0xd1, 0x85, 0x2e, 0x07, 0x84, 0xa7, 0x20, 0x61, 0xd1, 0x85, 0x2e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0xcf, 0x07, 0x00, 0x00,
+    0xa5, 0x0a, 0x00, 0x00, 0x47, 0x0c, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00,
+    0x65, 0x02, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x74, 0x68, 0x65, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x6f, 0x6f, 0x72,
+    0x59, 0x6f, 0x75, 0x20, 0x6b, 0x65, 0x79, 0x54, 0x68, 0x65, 0x61, 0x6e, 0x64, 0x64, 0x6f, 0x6f,
+    0x72, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x6f, 0x72, 0x67, 0x6f, 0x74, 0x74, 0x65, 0x6e, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x66, 0x6f, 0x72, 0x67, 0x6f, 0x74, 0x74, 0x65, 0x6e, 0x6b, 0x65, 0x79, 0x20,
+    0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x61, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x20,
+    0x6f, 0x70, 0x65, 0x6e, 0x20, 0x74, 0x6f, 0x72, 0x63, 0x68, 0x74, 0x6f, 0x77, 0x65, 0x72, 0x20,
+    0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x20, 0x6f, 0x72, 0x6e, 0x61, 0x74, 0x65, 0x61, 0x6c, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x61, 0x6e, 0x63, 0x69, 0x65, 0x6e, 0x74, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x72, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x72, 0x69, 0x76,
+    0x65, 0x72, 0x74, 0x6f, 0x72, 0x63, 0x68, 0x20, 0x63, 0x6c, 0x6f, 0x74, 0x68, 0x62, 0x72, 0x61,
+    0x6e, 0x63, 0x68, 0x6d, 0x65, 0x61, 0x64, 0x6f, 0x77, 0x6f, 0x70, 0x65, 0x6e, 0x6f, 0x72, 0x6e,
+    0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x6f, 0x46, 0x61, 0x72, 0x65, 0x77, 0x65, 0x6c,
+    0x6c, 0x6f, 0x66, 0x74, 0x72, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x20, 0x66, 0x6c, 0x6f, 0x77,
+    0x65, 0x72, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x20, 0x73, 0x77, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x76,
+    0x61, 0x6c, 0x65, 0x53, 0x61, 0x6e, 0x63, 0x74, 0x75, 0x6d, 0x63, 0x6c, 0x6f, 0x74, 0x68, 0x66,
+    0x72, 0x6f, 0x6d, 0x73, 0x61, 0x6e, 0x63, 0x74, 0x75, 0x6d, 0x20, 0x73, 0x75, 0x72, 0x72, 0x6f,
+    0x75, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x69, 0x76,
+    0x65, 0x72, 0x20, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x6f, 0x77, 0x65, 0x72, 0x4d, 0x65,
+    0x61, 0x64, 0x6f, 0x77, 0x66, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x75, 0x72, 0x72, 0x6f, 0x75,
+    0x6e, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x77, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
+    0x74, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x63, 0x61, 0x76,
+    0x65, 0x6e, 0x65, 0x65, 0x64, 0x76, 0x61, 0x6c, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x74, 0x68, 0x69,
+    0x6e, 0x67, 0x20, 0x64, 0x61, 0x6d, 0x70, 0x20, 0x69, 0x73, 0x20, 0x70, 0x6c, 0x65, 0x61, 0x73,
+    0x61, 0x6e, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x43, 0x72, 0x75, 0x6d, 0x62, 0x6c, 0x69, 0x6e,
+    0x67, 0x47, 0x6c, 0x61, 0x64, 0x65, 0x52, 0x69, 0x76, 0x65, 0x72, 0x52, 0x75, 0x69, 0x6e, 0x73,
+    0x54, 0x6f, 0x77, 0x65, 0x72, 0x56, 0x61, 0x75, 0x6c, 0x74, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x67,
+    0x6c, 0x61, 0x64, 0x65, 0x72, 0x75, 0x69, 0x6e, 0x73, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x74, 0x72,
+    0x61, 0x76, 0x65, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6d, 0x62, 0x65, 0x72, 0x20,
+    0x64, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0x20, 0x65, 0x61, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20,
+    0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x61, 0x6e, 0x79, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x69,
+    0x6e, 0x70, 0x6c, 0x65, 0x61, 0x73, 0x61, 0x6e, 0x74, 0x74, 0x6f, 0x20, 0x61, 0x63, 0x72, 0x6f,
+    0x73, 0x73, 0x20, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6c, 0x69,
+    0x63, 0x6b, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x6b, 0x73, 0x20, 0x68, 0x65, 0x72, 0x6d, 0x69,
+    0x74, 0x20, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x73, 0x20, 0x6c, 0x6f, 0x63,
+    0x6b, 0x65, 0x64, 0x20, 0x6d, 0x65, 0x61, 0x64, 0x6f, 0x77, 0x20, 0x6e, 0x61, 0x72, 0x72, 0x6f,
+    0x77, 0x20, 0x6f, 0x6c, 0x64, 0x20, 0x72, 0x69, 0x63, 0x68, 0x65, 0x73, 0x20, 0x72, 0x75, 0x62,
+    0x62, 0x6c, 0x65, 0x20, 0x73, 0x70, 0x69, 0x72, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x69, 0x72,
+    0x73, 0x20, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x20, 0x74, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x20,
+    0x75, 0x6e, 0x73, 0x65, 0x65, 0x6e, 0x20, 0x77, 0x6f, 0x6f, 0x64, 0x65, 0x6e, 0x41, 0x6e, 0x63,
+    0x69, 0x65, 0x6e, 0x74, 0x43, 0x61, 0x76, 0x65, 0x48, 0x69, 0x6c, 0x6c, 0x63, 0x68, 0x61, 0x6d,
+    0x62, 0x65, 0x72, 0x64, 0x61, 0x6d, 0x70, 0x64, 0x65, 0x73, 0x70, 0x69, 0x74, 0x65, 0x65, 0x61,
+    0x73, 0x74, 0x65, 0x72, 0x6e, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x73, 0x70, 0x65, 0x63,
+    0x69, 0x61, 0x6c, 0x77, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x66, 0x61, 0x64, 0x65, 0x64,
+    0x20, 0x68, 0x65, 0x61, 0x76, 0x79, 0x20, 0x68, 0x65, 0x72, 0x62, 0x73, 0x20, 0x6c, 0x61, 0x6e,
+    0x64, 0x73, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x74, 0x73, 0x20, 0x73,
+    0x63, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x73,
+    0x61, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x63, 0x6c, 0x69, 0x63,
+    0x6b, 0x73, 0x63, 0x72, 0x65, 0x61, 0x6b, 0x73, 0x68, 0x65, 0x72, 0x6d, 0x69, 0x74, 0x6c, 0x65,
+    0x61, 0x76, 0x65, 0x73, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x6e, 0x61, 0x72, 0x72, 0x6f, 0x77,
+    0x72, 0x69, 0x63, 0x68, 0x65, 0x73, 0x72, 0x75, 0x62, 0x62, 0x6c, 0x65, 0x73, 0x70, 0x69, 0x72,
+    0x61, 0x6c, 0x73, 0x74, 0x61, 0x69, 0x72, 0x73, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x73, 0x74, 0x75,
+    0x6e, 0x6e, 0x65, 0x6c, 0x75, 0x6e, 0x73, 0x65, 0x65, 0x6e, 0x77, 0x6f, 0x6f, 0x64, 0x65, 0x6e,
+    0x79, 0x6f, 0x75, 0x72, 0x20, 0x61, 0x72, 0x63, 0x68, 0x20, 0x63, 0x61, 0x76, 0x65, 0x20, 0x63,
+    0x6f, 0x6c, 0x64, 0x20, 0x64, 0x75, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x6c, 0x69,
+    0x6b, 0x65, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x77, 0x69, 0x64, 0x65, 0x66, 0x61, 0x64, 0x65, 0x64, 0x66, 0x6f, 0x72, 0x68, 0x65,
+    0x61, 0x76, 0x79, 0x68, 0x65, 0x72, 0x62, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x71, 0x75, 0x69,
+    0x65, 0x74, 0x72, 0x65, 0x73, 0x74, 0x73, 0x73, 0x63, 0x65, 0x6e, 0x74, 0x73, 0x6d, 0x61, 0x6c,
+    0x6c, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x76, 0x61, 0x75, 0x6c, 0x74, 0x79, 0x6f, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+    0x1d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x66, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
+    0x97, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+    0xad, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+    0xc1, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00,
+    0xd7, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+    0xef, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00,
+    0x0c, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00,
+    0x24, 0x01, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00,
+    0x3f, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00,
+    0x55, 0x01, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+    0x6a, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00,
+    0x86, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00,
+    0x9a, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00,
+    0xae, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00,
+    0xcf, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00,
+    0xef, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00,
+    0x02, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00,
+    0x1a, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00,
+    0x33, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00,
+    0x4c, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x5a, 0x02, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00,
+    0x68, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00,
+    0x84, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
+    0x97, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00,
+    0xb3, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00,
+    0xcc, 0x02, 0x00, 0x00, 0xd2, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00,
+    0xe4, 0x02, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xf6, 0x02, 0x00, 0x00,
+    0xfc, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00,
+    0x14, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2c, 0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x3e, 0x03, 0x00, 0x00,
+    0x44, 0x03, 0x00, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00,
+    0x59, 0x03, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x63, 0x03, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00,
+    0x6d, 0x03, 0x00, 0x00, 0x72, 0x03, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x00, 0x00,
+    0x81, 0x03, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x00,
+    0x93, 0x03, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00,
+    0xa7, 0x03, 0x00, 0x00, 0xac, 0x03, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00,
+    0xbb, 0x03, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+    0x2b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+    0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+    0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+    0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x1d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+    0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+    0x6a, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x61, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+    0x6b, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+    0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+    0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+    0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x87, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xce, 0xd8, 0xa5, 0xc5, 0x63, 0xd3, 0xf8, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcf, 0x5b, 0xd3, 0xb8, 0x62, 0xc3, 0xe1, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x5d, 0xa5, 0x1d, 0x64, 0x71, 0x4b, 0x51, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x39, 0x45, 0x61, 0x38, 0xab, 0x5c, 0x71, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x9a, 0x40, 0xd1, 0x5a, 0xc7, 0xd1, 0x6c, 0x52, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9b, 0x24, 0x96, 0x1f, 0x51, 0x7f, 0xd9, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x5b, 0x6a, 0xdd, 0xa7, 0x9a, 0xee, 0xe9, 0xd2, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x54, 0x20, 0x12, 0x03, 0xa3, 0xfc, 0x56, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0xf8, 0xc3, 0x7d, 0xb4, 0xf0, 0x94, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x25, 0xb1, 0xd9, 0x78, 0x9e, 0xb4, 0x9d, 0x44, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0xc0, 0xfd, 0x33, 0xa0, 0xc5, 0x7a, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xe9, 0x2d, 0xd5, 0xce, 0x5c, 0x8f, 0x64, 0x09, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xae, 0x3e, 0xd1, 0x78, 0xa8, 0x67, 0xc7, 0x6b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6e, 0x6f, 0x51, 0xbf, 0xc5, 0xa8, 0xe6, 0x3b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x56, 0x9b, 0xbd, 0x5b, 0xc3, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0xe6, 0x09, 0x39, 0x1d, 0xcb, 0x9d, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xf7, 0xd3, 0x89, 0x9c, 0x86, 0xa0, 0x58, 0x81, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x7a, 0x6e, 0xe5, 0xc5, 0x32, 0xd1, 0x9c, 0x70, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t kCampaignImageSize = sizeof(kCampaignImage);
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+// The built-in campaign's world image, compiled from vale.world into the
+// program itself (campaign.cpp is written by "vale --bake vale.world
+// campaign.cpp"). The bytes are constant data, so they are paged in from the
+// executable like its code and used in place, as a mapped image would be.
+extern const unsigned char kCampaignImage[];
+extern const size_t kCampaignImageSize;
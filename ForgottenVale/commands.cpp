@@ -0,0 +1,183 @@
+#include "commands.h"
+
+#include <algorithm> // std::sort, std::unique
+#include <cctype>    // std::tolower, std::isspace
+#include <cstring>   // std::memcpy
+
+// Hash of word with the character at skip removed (skip == size keeps the
+// whole word), salted with the scope so actions never share keys with verbs
+static uint64_t variantKey(uint32_t scope, std::string_view word, size_t skip) {
+    uint64_t h = 1469598103934665603ull; // FNV-1a
+    for (size_t i = 0; i < word.size(); ++i) {
+        if (i == skip) continue;
+        h ^= static_cast<unsigned char>(word[i]);
+        h *= 1099511628211ull;
+    }
+    h ^= (static_cast<uint64_t>(scope) + 1) * 0x9E3779B97F4A7C15ull;
+    return mix(h); // spread the bits before masking into the table
+}
+
+// Key of an action name within one room; distinct pairs give distinct keys
+static uint64_t roomAction(RoomId room, Symbol name) {
+    return mix(uint64_t{room} << 32 | name);
+}
+
+void CommandIndex::insert(std::string_view word, Posting posting) {
+    for (size_t skip = 0; skip <= word.size(); ++skip)
+        pending.emplace_back(variantKey(posting.scope, word, skip), posting);
+}
+
+void CommandIndex::addVerb(Verb verb, std::initializer_list<const char*> synonyms) {
+    const size_t id = static_cast<size_t>(verb);
+    if (verbs.size() <= id) verbs.resize(id + 1, SynonymGroup{});
+    verbs[id] = SynonymGroup(synonyms);
+    for (const auto& word : verbs[id].words)
+        insert(word, {kVerbs, static_cast<uint32_t>(id)});
+}
+
+void CommandIndex::addActions(Span<Symbol> names, Span<uint32_t> start) {
+    std::vector<Symbol> distinct(names.begin(), names.end());
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+    for (Symbol name : distinct) insert(symbolText(name), {kActions, name});
+
+    // Only the first of a name in a room can ever be picked
+    std::vector<std::pair<uint64_t, uint32_t>> at;
+    at.reserve(names.size());
+    for (RoomId r = 0; r + 1 < start.size(); ++r) {
+        for (uint32_t a = start[r]; a < start[r + 1]; ++a)
+            at.emplace_back(roomAction(r, names[a]), a - start[r]);
+    }
+    std::stable_sort(at.begin(), at.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    at.erase(std::unique(at.begin(), at.end(), [](const auto& a, const auto& b) { return a.first == b.first; }),
+             at.end());
+    actionAt.build(at);
+}
+
+void CommandIndex::build() {
+    std::sort(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+        if (a.first != b.first) return a.first < b.first;
+        if (a.second.scope != b.second.scope) return a.second.scope < b.second.scope;
+        return a.second.id < b.second.id;
+    });
+    // Deleting either 'o' from "look" yields the same key twice
+    pending.erase(std::unique(pending.begin(), pending.end(), [](const auto& a, const auto& b) {
+        return a.first == b.first && a.second.scope == b.second.scope && a.second.id == b.second.id;
+    }), pending.end());
+
+    postings.build(pending);
+    pending.clear();
+    pending.shrink_to_fit();
+}
+
+CommandMatch CommandIndex::lookup(std::string_view word, Room room) const {
+    CommandMatch match;
+    if (postings.empty()) return match;
+    uint32_t checked = 0; // verbs whose synonyms were already compared
+
+    const bool hasActions = room.world && !room.actions().empty();
+    auto probe = [&](uint32_t scope, size_t skip) {
+        // A shared deletion is necessary but not sufficient for one edit
+        // ("ab" and "ba" both reduce to "a"), so every candidate is verified
+        for (const Posting& p : postings.find(variantKey(scope, word, skip))) {
+            if (p.scope != scope) continue;
+            if (scope == kVerbs) {
+                const uint32_t bit = 1u << p.id;
+                if (checked & bit) continue;
+                checked |= bit;
+                if (matchSynonym(word, verbs[p.id]) >= 0) match.verbs |= bit;
+                continue;
+            }
+            // Rooms list their actions in priority order, so the first one
+            // with a matching name wins
+            const Span<uint32_t> at = actionAt.find(roomAction(room.id, p.id));
+            if (at.empty()) continue;
+            const int j = static_cast<int>(at[0]);
+            if (match.action >= 0 && j >= match.action) continue;
+            if (withinOneEdit(word, symbolText(p.id))) match.action = j;
+        }
+    };
+
+    for (size_t skip = 0; skip <= word.size(); ++skip) {
+        probe(kVerbs, skip);
+        if (hasActions) probe(kActions, skip);
+    }
+    return match;
+}
+
+// ------------ Splitting typed lines ------------
+
+static constexpr std::string_view kStopWords[] = {
+    "the", "a", "an", "at", "to", "with", "on", "in", "into", "from", "off",
+};
+
+static constexpr uint32_t stopHash(std::string_view word) {
+    uint32_t h = 2166136261u; // FNV-1a
+    for (char c : word) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// The stop words in open addressing, laid out by the compiler
+struct StopTable {
+    static const uint32_t kSlots = 32; // a power of two, under half full
+    std::string_view slots[kSlots] = {};
+};
+
+static constexpr StopTable makeStopTable() {
+    StopTable table;
+    for (std::string_view word : kStopWords) {
+        uint32_t pos = stopHash(word) & (StopTable::kSlots - 1);
+        while (!table.slots[pos].empty()) pos = (pos + 1) & (StopTable::kSlots - 1);
+        table.slots[pos] = word;
+    }
+    return table;
+}
+
+static constexpr StopTable kStopTable = makeStopTable();
+
+bool isStopWord(std::string_view word) {
+    if (word.size() > 4) return false; // longer than any of them
+    for (uint32_t pos = stopHash(word) & (StopTable::kSlots - 1); !kStopTable.slots[pos].empty();
+         pos = (pos + 1) & (StopTable::kSlots - 1)) {
+        if (kStopTable.slots[pos] == word) return true;
+    }
+    return false;
+}
+
+Span<std::string_view> splitCommand(std::string_view line, Arena& arena) {
+    char* text = arena.allocate<char>(line.size());
+    for (size_t i = 0; i < line.size(); ++i)
+        text[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(line[i])));
+    // No more words than every other character
+    std::string_view* words = arena.allocate<std::string_view>((line.size() + 1) / 2);
+    size_t count = 0;
+    for (size_t i = 0; i < line.size();) {
+        if (std::isspace(static_cast<unsigned char>(text[i]))) {
+            ++i;
+            continue;
+        }
+        const size_t begin = i;
+        while (i < line.size() && !std::isspace(static_cast<unsigned char>(text[i]))) ++i;
+        const std::string_view word(text + begin, i - begin);
+        if (!isStopWord(word)) words[count++] = word;
+    }
+    return {words, words + count};
+}
+
+std::string_view joinWords(Span<std::string_view> words, size_t first, size_t last, Arena& arena) {
+    if (first >= last) return {};
+    if (last - first == 1) return words[first];
+    size_t size = last - first - 1;
+    for (size_t i = first; i < last; ++i) size += words[i].size();
+    char* text = arena.allocate<char>(size);
+    char* at = text;
+    for (size_t i = first; i < last; ++i) {
+        if (i > first) *at++ = ' ';
+        std::memcpy(at, words[i].data(), words[i].size());
+        at += words[i].size();
+    }
+    return {text, size};
+}
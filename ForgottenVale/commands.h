@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.h"
+#include "fuzzy.h"
+#include "hashing.h"
+#include "room.h"
+
+// Every verb the main loop knows how to handle
+enum class Verb : uint8_t {
+    Help,
+    Look,
+    Talk,
+    Go,
+    Travel,
+    Take,
+    Drop,
+    Combine,
+    Use,
+    Inventory,
+    Exit,
+    Rewind,
+    Count
+};
+
+// Everything a single typed word could mean, resolved in one lookup
+struct CommandMatch {
+    uint32_t verbs = 0; // one bit per Verb within one edit of the word
+    int action = -1;    // position in the room's action list, or -1
+
+    bool has(Verb v) const { return (verbs >> static_cast<unsigned>(v)) & 1u; }
+};
+
+// Deletion-neighbourhood index (SymSpell style) over every verb synonym and
+// action name. Each word is stored under itself and each of its one-character
+// deletions, so a typed word only has to probe its own deletions to find every
+// candidate within one edit. Actions are indexed by name rather than by room,
+// so the deletion index grows with the names a world uses, not with its
+// size; a second table gives where each name first comes in each room's
+// list, so a candidate is placed with one probe. Built once at startup;
+// lookups never allocate.
+struct CommandIndex {
+    void addVerb(Verb verb, std::initializer_list<const char*> synonyms);
+    // Room r's actions are names[start[r], start[r + 1]), in priority order,
+    // as in World::actionName; names may repeat
+    void addActions(Span<Symbol> names, Span<uint32_t> start);
+    void build();
+
+    CommandMatch lookup(std::string_view word, Room room) const;
+
+private:
+    struct Posting {
+        uint32_t scope; // kVerbs or kActions
+        uint32_t id;    // Verb, or the action's name
+    };
+    static const uint32_t kVerbs = 0;
+    static const uint32_t kActions = 1;
+
+    void insert(std::string_view word, Posting posting);
+
+    std::vector<SynonymGroup> verbs;
+    std::vector<std::pair<uint64_t, Posting>> pending; // filled before build()
+    KeyedRanges<Posting> postings;
+    KeyedRanges<uint32_t> actionAt; // by roomAction(room, name): position in the room's list
+};
+
+// A typed line as the words that matter: lowercased, split on whitespace and
+// without filler such as "the" and "to". The words and their text live in
+// arena, so splitting a line never touches the heap.
+Span<std::string_view> splitCommand(std::string_view line, Arena& arena);
+// True for the filler words splitCommand drops
+bool isStopWord(std::string_view word);
+// words[first..] joined with single spaces, as in "rusty key"; a single word
+// is returned as it is, anything longer is copied into arena
+std::string_view joinWords(Span<std::string_view> words, size_t first, size_t last, Arena& arena);
+inline std::string_view joinWords(Span<std::string_view> words, size_t first, Arena& arena) {
+    return joinWords(words, first, words.size(), arena);
+}
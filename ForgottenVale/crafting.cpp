@@ -0,0 +1,89 @@
+#include "crafting.h"
+
+#include <algorithm> // std::sort, std::unique, std::remove_if
+
+// Summing per-item hashes makes the key independent of input order, and
+// weighting each by its count tells "2 cloth" from "cloth"
+static uint64_t itemKey(Symbol item, uint32_t count) {
+    return mix(uint64_t{item} + 1) * count;
+}
+
+static uint64_t multisetKey(const Symbol* items, const uint32_t* counts, size_t n) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < n; ++i) sum += itemKey(items[i], counts[i]);
+    return mix(sum);
+}
+
+void RecipeIndex::build(const World& w) {
+    world = &w;
+    const size_t recipes = w.recipeCount();
+
+    std::vector<std::pair<uint64_t, uint32_t>> keyed;
+    keyed.reserve(recipes);
+    for (uint32_t r = 0; r < recipes; ++r) {
+        const uint32_t first = w.recipeInputStart[r];
+        const size_t n = w.recipeInputStart[r + 1] - first;
+        keyed.emplace_back(multisetKey(&w.recipeInputItem[first], &w.recipeInputCount[first], n), r);
+    }
+    std::sort(keyed.begin(), keyed.end());
+    byKey.build(keyed);
+
+    // Ingredient -> recipes, as CSR over every symbol
+    usedByStart.assign(symbolCount() + 1, 0);
+    for (Symbol item : w.recipeInputItem) ++usedByStart[item + 1];
+    for (size_t s = 0; s + 1 < usedByStart.size(); ++s) usedByStart[s + 1] += usedByStart[s];
+    usedBy.assign(w.recipeInputItem.size(), 0);
+    std::vector<uint32_t> next(usedByStart.begin(), usedByStart.end() - 1);
+    for (uint32_t r = 0; r < recipes; ++r) {
+        for (uint32_t i = w.recipeInputStart[r]; i < w.recipeInputStart[r + 1]; ++i)
+            usedBy[next[w.recipeInputItem[i]]++] = r;
+    }
+}
+
+uint32_t RecipeIndex::find(ItemStack* inputs, size_t count) const {
+    if (byKey.empty() || count == 0) return kNoRecipe;
+
+    // Same order and merging as the recipes themselves
+    std::sort(inputs, inputs + count,
+              [](const ItemStack& a, const ItemStack& b) { return a.item < b.item; });
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (n > 0 && inputs[n - 1].item == inputs[i].item) inputs[n - 1].count += inputs[i].count;
+        else inputs[n++] = inputs[i];
+    }
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < n; ++i) sum += itemKey(inputs[i].item, inputs[i].count);
+    // Different multisets can share a hash, so every candidate is compared
+    for (uint32_t r : byKey.find(mix(sum))) {
+        const uint32_t first = world->recipeInputStart[r];
+        if (world->recipeInputStart[r + 1] - first != n) continue;
+        bool same = true;
+        for (size_t i = 0; i < n && same; ++i)
+            same = inputs[i].item == world->recipeInputItem[first + i] &&
+                   inputs[i].count == world->recipeInputCount[first + i];
+        if (same) return r;
+    }
+    return kNoRecipe;
+}
+
+void RecipeIndex::craftable(const ItemSet& inventory, std::vector<uint32_t>& recipes) const {
+    recipes.clear();
+    for (const ItemStack& stack : inventory) {
+        if (stack.item + size_t{1} >= usedByStart.size()) continue;
+        for (uint32_t i = usedByStart[stack.item]; i < usedByStart[stack.item + 1]; ++i)
+            recipes.push_back(usedBy[i]);
+    }
+    std::sort(recipes.begin(), recipes.end());
+    recipes.erase(std::unique(recipes.begin(), recipes.end()), recipes.end());
+
+    auto canMake = [&](uint32_t r) {
+        for (uint32_t i = world->recipeInputStart[r]; i < world->recipeInputStart[r + 1]; ++i) {
+            if (inventory.count(world->recipeInputItem[i]) < world->recipeInputCount[i]) return false;
+        }
+        return true;
+    };
+    recipes.erase(std::remove_if(recipes.begin(), recipes.end(),
+                                 [&](uint32_t r) { return !canMake(r); }),
+                  recipes.end());
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "hashing.h"
+#include "items.h"
+#include "world.h"
+
+constexpr uint32_t kNoRecipe = UINT32_MAX;
+
+// The world's crafting recipes, indexed two ways. By inputs: each recipe is
+// filed under a hash of its input multiset that ignores order, so finding
+// what a set of items makes is one probe plus an exact check of whatever
+// shares the hash. By ingredient: every item lists the recipes that use it,
+// so "what can I craft" only visits recipes touching something carried.
+// Built once at startup and read-only afterwards.
+struct RecipeIndex {
+    void build(const World& world);
+
+    // Recipe whose inputs are exactly these stacks in any order, or kNoRecipe.
+    // An item may appear in more than one stack; the counts are added up.
+    // The stacks are sorted and merged in place.
+    uint32_t find(ItemStack* inputs, size_t count) const;
+
+    // Every recipe the inventory holds all the inputs for, in recipe order
+    void craftable(const ItemSet& inventory, std::vector<uint32_t>& recipes) const;
+
+private:
+    const World* world = nullptr;
+    KeyedRanges<uint32_t> byKey;       // recipes by input hash
+    std::vector<uint32_t> usedByStart; // per symbol, range into usedBy
+    std::vector<uint32_t> usedBy;      // recipes, ascending within each symbol
+};
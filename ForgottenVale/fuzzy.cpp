@@ -0,0 +1,161 @@
+#include "fuzzy.h"
+
+#include <algorithm> // std::min, std::swap
+#include <cstring>   // std::memcpy, std::memset
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VALE_FUZZY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Plain two-row DP restricted to a diagonal band of width 2 * limit + 1.
+// Only reached when both words are longer than 64 characters.
+static int bandedEditDistance(std::string_view a, std::string_view b, int limit) {
+    const int n = static_cast<int>(b.size());
+    std::vector<int> prev(n + 1), cur(n + 1);
+    const int inf = limit + 1;
+    for (int j = 0; j <= n; ++j) prev[j] = j <= limit ? j : inf;
+    for (int i = 1; i <= static_cast<int>(a.size()); ++i) {
+        int lo = std::max(1, i - limit);
+        int hi = std::min(n, i + limit);
+        int rowMin = inf;
+        cur[0] = i <= limit ? i : inf;
+        if (lo > 1) cur[lo - 1] = inf;
+        for (int j = lo; j <= hi; ++j) {
+            int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+            int v = std::min({prev[j - 1] + cost, prev[j] + 1, cur[j - 1] + 1});
+            cur[j] = std::min(v, inf);
+            rowMin = std::min(rowMin, cur[j]);
+        }
+        if (hi < n) cur[hi + 1] = inf;
+        if (rowMin > limit) return inf;
+        std::swap(prev, cur);
+    }
+    return std::min(prev[n], inf);
+}
+
+// Myers/Hyyro bit-vector edit distance. Column j of the DP matrix is held as
+// vertical +1/-1 deltas in two machine words, so each text character costs a
+// handful of bit operations regardless of pattern length (up to 64).
+int boundedEditDistance(std::string_view a, std::string_view b, int limit) {
+    if (a.size() > b.size()) std::swap(a, b); // the shorter word is the pattern
+    const int m = static_cast<int>(a.size());
+    const int n = static_cast<int>(b.size());
+    if (n - m > limit) return limit + 1;
+    if (m == 0) return n;
+    if (m > 64) return bandedEditDistance(a, b, limit);
+
+    // Match masks per byte value; entries are cleared again before returning
+    // so the table stays zeroed between calls without a full memset.
+    thread_local uint64_t peq[256] = {};
+    for (int i = 0; i < m; ++i)
+        peq[static_cast<unsigned char>(a[i])] |= uint64_t{1} << i;
+
+    const uint64_t last = uint64_t{1} << (m - 1);
+    uint64_t pv = m == 64 ? ~uint64_t{0} : (last << 1) - 1;
+    uint64_t mv = 0;
+    int score = m;
+    for (int j = 0; j < n; ++j) {
+        uint64_t eq = peq[static_cast<unsigned char>(b[j])];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & last) ++score;
+        else if (mh & last) --score;
+        ph = (ph << 1) | 1; // row 0 grows by one per column
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        // The final score can drop by at most one per remaining column
+        if (score - (n - 1 - j) > limit) {
+            score = limit + 1;
+            break;
+        }
+    }
+
+    for (int i = 0; i < m; ++i) peq[static_cast<unsigned char>(a[i])] = 0;
+    return std::min(score, limit + 1);
+}
+
+bool withinOneEdit(std::string_view a, std::string_view b) {
+    return boundedEditDistance(a, b, 1) <= 1;
+}
+
+SynonymGroup::SynonymGroup(std::initializer_list<const char*> list)
+    : words(list.begin(), list.end()) {
+    bool fits = true;
+    for (const auto& w : words) fits = fits && w.size() <= kSlotChars;
+    if (fits) {
+        slots.resize(words.size());
+        for (size_t i = 0; i < words.size(); ++i) {
+            std::memset(slots[i].bytes, 0, sizeof(slots[i].bytes));
+            std::memcpy(slots[i].bytes, words[i].data(), words[i].size());
+        }
+        lengths.assign((words.size() + 15) / 16 * 16, 0xFF);
+        for (size_t i = 0; i < words.size(); ++i)
+            lengths[i] = static_cast<unsigned char>(words[i].size());
+    }
+}
+
+#ifdef VALE_FUZZY_SSE2
+// Both buffers hold a word of at most 16 characters followed by zeros, so a
+// byte compare covers the whole word and loading at +1 drops its first
+// character. Words are assumed to contain no NUL bytes.
+static bool slotWithinOneEdit(const char* a, size_t la, const char* b, size_t lb) {
+    if (la < lb) {
+        std::swap(a, b);
+        std::swap(la, lb);
+    }
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    unsigned mismatch = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) & 0xFFFFu;
+    if (la == lb) // substitutions only: at most one differing byte
+        return (mismatch & (mismatch - 1)) == 0;
+
+    // a is one longer: skip its first mismatching character and the rest of
+    // a must line up with b from that position onwards
+    const unsigned first = mismatch & (0u - mismatch);
+    const __m128i va1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + 1));
+    unsigned shifted = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va1, vb))) & 0xFFFFu;
+    return (shifted & ~(first - 1)) == 0;
+}
+#endif
+
+int matchSynonym(std::string_view word, const SynonymGroup& group) {
+#ifdef VALE_FUZZY_SSE2
+    if (!group.slots.empty() && word.size() <= SynonymGroup::kSlotChars) {
+        alignas(16) char in[2 * SynonymGroup::kSlotChars] = {};
+        std::memcpy(in, word.data(), word.size());
+
+        // Compare the word length against sixteen synonym lengths at once and
+        // only run the byte compare on words that differ by at most one
+        const __m128i len = _mm_set1_epi8(static_cast<char>(word.size()));
+        const __m128i one = _mm_set1_epi8(1);
+        for (size_t base = 0; base < group.lengths.size(); base += 16) {
+            const __m128i lens = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(group.lengths.data() + base));
+            const __m128i nearLen = _mm_or_si128(
+                _mm_cmpeq_epi8(lens, len),
+                _mm_or_si128(_mm_cmpeq_epi8(lens, _mm_add_epi8(len, one)),
+                             _mm_cmpeq_epi8(lens, _mm_sub_epi8(len, one))));
+            unsigned candidates = static_cast<unsigned>(_mm_movemask_epi8(nearLen));
+            if (group.words.size() - base < 16) // ignore the padding lanes
+                candidates &= (1u << (group.words.size() - base)) - 1;
+            for (size_t k = 0; candidates; ++k, candidates >>= 1) {
+                if (!(candidates & 1u)) continue;
+                size_t i = base + k;
+                if (slotWithinOneEdit(in, word.size(), group.slots[i].bytes,
+                                      group.words[i].size()))
+                    return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+#endif
+    for (size_t i = 0; i < group.words.size(); ++i) {
+        if (withinOneEdit(word, group.words[i]))
+            return static_cast<int>(i);
+    }
+    return -1;
+}
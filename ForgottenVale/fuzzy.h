@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Edit distance between a and b, but only computed up to limit: any distance
+// larger than limit is reported as limit + 1. Uses a bit-parallel kernel for
+// words up to 64 characters and never allocates for them.
+int boundedEditDistance(std::string_view a, std::string_view b, int limit);
+
+// True if a and b differ by at most one insertion, deletion or substitution
+bool withinOneEdit(std::string_view a, std::string_view b);
+
+// A fixed set of synonyms ("look", "examine", "inspect") prepared once so a
+// typed word can be checked against the whole group in a single call.
+struct SynonymGroup {
+    // Words this short are stored in padded slots for the SIMD path
+    static constexpr size_t kSlotChars = 16;
+
+    struct alignas(16) Slot {
+        char bytes[2 * kSlotChars]; // word followed by zero padding
+    };
+
+    std::vector<std::string> words;
+    std::vector<Slot> slots;           // one per word, empty if any word is too long
+    std::vector<unsigned char> lengths; // word lengths, padded to a multiple of 16
+
+    SynonymGroup(std::initializer_list<const char*> list);
+};
+
+// Index of the first synonym within one edit of word, or -1
+int matchSynonym(std::string_view word, const SynonymGroup& group);
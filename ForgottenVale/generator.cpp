@@ -0,0 +1,664 @@
+#include "generator.h"
+
+#include <algorithm> // std::min, std::max
+#include <chrono>
+#include <cmath>     // std::sqrt
+#include <string>
+#include <vector>
+
+#include "hashing.h"
+#include "rng.h"
+#include "symbols.h"
+
+static const uint32_t kRegionSide = 32;  // rooms along each side of a region
+static const size_t kChunk = 4096;       // rooms generated together
+static const uint32_t kNpcOdds = 64;     // one room in this many has an NPC
+static const uint32_t kLockOdds = 128;   // one passage north in this many is locked
+static const uint32_t kLoopOdds = 8;     // one room in this many opens both ways
+
+template <typename T, size_t N>
+static Span<T> all(const T (&table)[N]) {
+    return {table, table + N};
+}
+
+// ------------ Landscapes ------------
+
+struct Named {
+    const char* name;
+    const char* text;
+};
+
+// Everything a region's rooms are made of. Items come commonest first.
+struct Landscape {
+    const char* name;
+    Span<const char*> adjectives, nouns;
+    Span<const char*> openings, details; // a room's description is one of each
+    Span<Named> pois, actions;
+    Span<const char*> items;
+    Span<const char*> events;
+};
+
+static const char* const forestAdjectives[] = {"Mossy", "Shaded", "Whispering", "Tangled", "Sunlit", "Ancient", "Quiet", "Fern-choked"};
+static const char* const forestNouns[] = {"Glade", "Thicket", "Hollow", "Grove", "Clearing", "Dell", "Copse", "Path"};
+static const char* const forestOpenings[] = {
+    "Tall oaks crowd close, their branches knitting a green roof overhead.",
+    "Sunlight falls in slanting shafts between the birches.",
+    "Ferns brush your knees on a narrow deer track.",
+    "A fallen beech lies across the way, furred with moss.",
+    "The forest floor is soft with years of needles.",
+    "Ivy climbs every trunk in sight."};
+static const char* const forestDetails[] = {
+    "Somewhere a woodpecker drums.",
+    "The air smells of resin and damp earth.",
+    "Mushrooms ring the base of a stump.",
+    "A squirrel scolds you from above.",
+    "Old blazes mark a few of the trunks.",
+    "The path forks and rejoins ahead."};
+static const Named forestPois[] = {
+    {"stump", "A wide stump, its rings too many to count."},
+    {"nest", "A tangle of twigs cradles a few speckled eggshells."},
+    {"oak", "The oak's bark is scarred where a stag once rubbed."},
+    {"brambles", "Thorny brambles heavy with berries."},
+    {"hive", "Bees drone in and out of a split in a dead tree."},
+    {"blaze", "An axe-cut blaze, long healed over."}};
+static const Named forestActions[] = {
+    {"rest", "You rest against a trunk and listen to the leaves."},
+    {"climb", "You climb a little way up and glimpse more trees."},
+    {"listen", "Birdsong, wind, and far off, running water."},
+    {"forage", "You poke through the undergrowth but turn up little."}};
+static const char* const forestItems[] = {"branch", "berries", "mushroom", "pinecone", "feather", "beeswax", "herbs"};
+static const char* const forestEvents[] = {
+    "A sudden gust shakes loose a shower of leaves.",
+    "A deer bolts across the path and is gone."};
+
+static const char* const marshAdjectives[] = {"Misty", "Sodden", "Reed-choked", "Still", "Grey", "Sunken", "Murky", "Quaking"};
+static const char* const marshNouns[] = {"Fen", "Mire", "Bog", "Pool", "Causeway", "Reedbed", "Hummock", "Channel"};
+static const char* const marshOpenings[] = {
+    "Black water stands between tussocks of sedge.",
+    "Reeds rise higher than your head on every side.",
+    "A line of rotten posts marks a drowned causeway.",
+    "The ground quakes underfoot like a held breath.",
+    "Mist lies on the water in thin grey sheets.",
+    "Pale flowers float on a pool so still it mirrors the sky."};
+static const char* const marshDetails[] = {
+    "Frogs fall silent as you pass.",
+    "Bubbles rise and burst with a sour smell.",
+    "A heron stands motionless in the shallows.",
+    "Midges dance in clouds above the reeds.",
+    "Something slips into the water with a soft plop.",
+    "The way on is marked with bundles of tied reeds."};
+static const Named marshPois[] = {
+    {"heron", "A grey heron watches the water with terrible patience."},
+    {"posts", "Rotten posts, all that is left of a boardwalk."},
+    {"pool", "Dark water. You cannot see the bottom."},
+    {"lilies", "Water lilies crowd a sheltered corner."},
+    {"skull", "The bleached skull of an ox, half sunk in mud."},
+    {"rushes", "Rushes tied into a crude marker."}};
+static const Named marshActions[] = {
+    {"wade", "You wade in to your knees and think better of it."},
+    {"listen", "Croaking, buzzing, and the slow suck of mud."},
+    {"rest", "You find a dry hummock and rest a while."},
+    {"search", "You probe the mud and find only more mud."}};
+static const char* const marshItems[] = {"reeds", "herbs", "clay", "feather", "mushroom", "bone"};
+static const char* const marshEvents[] = {
+    "Marsh lights flicker out over the water.",
+    "A bittern booms somewhere in the reeds."};
+
+static const char* const hillAdjectives[] = {"Windswept", "Rocky", "Heather-clad", "Bare", "High", "Stony", "Rolling", "Lonely"};
+static const char* const hillNouns[] = {"Ridge", "Tor", "Slope", "Saddle", "Crag", "Down", "Knoll", "Pass"};
+static const char* const hillOpenings[] = {
+    "Heather and bracken roll away under a wide sky.",
+    "The wind never stops up here, tugging at your clothes.",
+    "Grey rock breaks through the thin turf.",
+    "A sheep track winds between boulders.",
+    "From here you can see for miles in every direction.",
+    "A dry-stone wall runs along the slope, tumbled in places."};
+static const char* const hillDetails[] = {
+    "A hawk hangs motionless on the wind.",
+    "Sheep watch you with mild suspicion.",
+    "Lichen crusts every stone.",
+    "A cold spring seeps out of the hillside.",
+    "Cloud shadows race across the land below.",
+    "Somewhere a curlew calls."};
+static const Named hillPois[] = {
+    {"cairn", "A heap of stones marks the summit."},
+    {"wall", "A dry-stone wall, built without mortar long ago."},
+    {"boulder", "A boulder the size of a cottage, split down the middle."},
+    {"spring", "Clear water trickles from a crack in the rock."},
+    {"view", "Valleys and ridges fold away to the horizon."},
+    {"fold", "A ruined sheepfold, its gate long gone."}};
+static const Named hillActions[] = {
+    {"climb", "You scramble up the rocks for a better view."},
+    {"rest", "You sit out of the wind for a while."},
+    {"drink", "The spring water is icy and sweet."},
+    {"shout", "Your voice echoes back from the far slopes."}};
+static const char* const hillItems[] = {"stone", "flint", "herbs", "bone", "berries", "feather"};
+static const char* const hillEvents[] = {
+    "The wind rises to a howl, then drops.",
+    "A rockfall rattles somewhere below."};
+
+static const char* const coastAdjectives[] = {"Salt-worn", "Rocky", "Sandy", "Gull-haunted", "Wind-bitten", "Pebbled", "Wave-cut", "Drowned"};
+static const char* const coastNouns[] = {"Shore", "Cove", "Strand", "Headland", "Inlet", "Beach", "Point", "Dunes"};
+static const char* const coastOpenings[] = {
+    "Waves break white against black rocks.",
+    "Sand stretches away under a pale sky.",
+    "The tide has left pools among the rocks.",
+    "Marram grass hisses on the dunes.",
+    "Cliffs rise behind a narrow strip of shingle.",
+    "Driftwood lies heaped along the tideline."};
+static const char* const coastDetails[] = {
+    "Gulls wheel and cry overhead.",
+    "The air tastes of salt.",
+    "A crab scuttles sideways into a crevice.",
+    "Foam drifts in on every wave.",
+    "Far out, a seal lifts its head to look at you.",
+    "Kelp lies in slick brown ropes."};
+static const Named coastPois[] = {
+    {"rock pool", "A rock pool full of anemones and tiny fish."},
+    {"wreck", "The ribs of an old boat, blackened by the sea."},
+    {"cliff", "Sea birds nest on every ledge of the cliff."},
+    {"tideline", "Shells, weed and sea-smoothed glass."},
+    {"sea cave", "A sea cave that floods at high tide."},
+    {"buoy", "A rusted buoy, washed far up the beach."}};
+static const Named coastActions[] = {
+    {"swim", "The cold takes your breath away. You don't stay in long."},
+    {"beachcomb", "You walk the tideline, turning over weed."},
+    {"listen", "Waves, gulls, and the wind."},
+    {"rest", "You rest in the lee of a dune."}};
+static const char* const coastItems[] = {"shell", "driftwood", "stone", "glass shard", "reeds", "cloth"};
+static const char* const coastEvents[] = {
+    "A big wave booms into the rocks and sends spray high.",
+    "A ship's bell sounds somewhere out in the fog."};
+
+static const char* const ruinAdjectives[] = {"Crumbling", "Forgotten", "Burnt", "Roofless", "Overgrown", "Silent", "Fallen", "Broken"};
+static const char* const ruinNouns[] = {"Hall", "Courtyard", "Chapel", "Gatehouse", "Cloister", "Cellar", "Keep", "Square"};
+static const char* const ruinOpenings[] = {
+    "Broken walls stand open to the sky.",
+    "Weeds push up between cracked flagstones.",
+    "Charred beams lean against a blackened wall.",
+    "An archway stands alone, the wall around it long gone.",
+    "Rubble lies heaped where a roof fell in.",
+    "Carved stones lie scattered in the grass."};
+static const char* const ruinDetails[] = {
+    "A crow watches from a window with no glass.",
+    "The wind whistles through empty doorways.",
+    "Faded paint still clings to one wall.",
+    "Ivy has pulled down part of the masonry.",
+    "Something small scurries under the rubble.",
+    "Your footsteps echo strangely here."};
+static const Named ruinPois[] = {
+    {"arch", "An arch carved with worn, unreadable letters."},
+    {"well", "A well, its rope long rotted. A dropped stone takes a while to land."},
+    {"statue", "A statue with its face worn smooth."},
+    {"hearth", "A great hearth, cold for a hundred years."},
+    {"altar", "A cracked stone altar."},
+    {"mosaic", "A floor mosaic of birds, half its tiles missing."}};
+static const Named ruinActions[] = {
+    {"search", "You sift the rubble but find nothing of value."},
+    {"listen", "Only the wind, and your own breathing."},
+    {"rest", "You sit on a fallen column and rest."},
+    {"read", "The inscription is too worn to make out."}};
+static const char* const ruinItems[] = {"iron scrap", "cloth", "coin", "glass shard", "bone", "stone"};
+static const char* const ruinEvents[] = {
+    "Masonry shifts and a stone clatters down.",
+    "For a moment you hear what might be singing."};
+
+static const char* const caveAdjectives[] = {"Dripping", "Echoing", "Narrow", "Vaulted", "Pitch-dark", "Glittering", "Cold", "Winding"};
+static const char* const caveNouns[] = {"Cavern", "Tunnel", "Grotto", "Chamber", "Passage", "Gallery", "Chasm", "Shaft"};
+static const char* const caveOpenings[] = {
+    "Water drips steadily from the ceiling.",
+    "The passage narrows until you must turn sideways.",
+    "A vast chamber swallows the sound of your steps.",
+    "Crystals glint in the rock around you.",
+    "Cold air flows from somewhere deeper down.",
+    "The floor is slick with pale mud."};
+static const char* const caveDetails[] = {
+    "Bats rustle overhead.",
+    "Your breath steams in the chill.",
+    "Far below, water roars.",
+    "Old tool marks score the walls.",
+    "Stalactites hang like teeth.",
+    "The dark beyond seems to go on for ever."};
+static const Named cavePois[] = {
+    {"pool", "An underground pool, perfectly clear and very cold."},
+    {"crystals", "Clusters of quartz catch what little light there is."},
+    {"marks", "Tally marks scratched into the rock by some miner."},
+    {"chasm", "A crack in the floor too deep to see the bottom."},
+    {"bats", "Hundreds of bats hang folded in the dark."},
+    {"pillar", "Stalactite and stalagmite have met to form a pillar."}};
+static const Named caveActions[] = {
+    {"listen", "Drips, echoes, and something like breathing."},
+    {"shout", "Your shout rolls away into the dark and does not come back."},
+    {"rest", "You rest on a cold ledge."},
+    {"search", "You feel along the walls and find only rock."}};
+static const char* const caveItems[] = {"stone", "flint", "mushroom", "bone", "iron scrap", "clay"};
+static const char* const caveEvents[] = {
+    "A distant rumble shakes grit from the ceiling.",
+    "Water suddenly gushes from a crack, then stops."};
+
+static const Landscape landscapes[] = {
+    {"forest", all(forestAdjectives), all(forestNouns), all(forestOpenings), all(forestDetails),
+     all(forestPois), all(forestActions), all(forestItems), all(forestEvents)},
+    {"marsh", all(marshAdjectives), all(marshNouns), all(marshOpenings), all(marshDetails),
+     all(marshPois), all(marshActions), all(marshItems), all(marshEvents)},
+    {"hills", all(hillAdjectives), all(hillNouns), all(hillOpenings), all(hillDetails),
+     all(hillPois), all(hillActions), all(hillItems), all(hillEvents)},
+    {"coast", all(coastAdjectives), all(coastNouns), all(coastOpenings), all(coastDetails),
+     all(coastPois), all(coastActions), all(coastItems), all(coastEvents)},
+    {"ruins", all(ruinAdjectives), all(ruinNouns), all(ruinOpenings), all(ruinDetails),
+     all(ruinPois), all(ruinActions), all(ruinItems), all(ruinEvents)},
+    {"caverns", all(caveAdjectives), all(caveNouns), all(caveOpenings), all(caveDetails),
+     all(cavePois), all(caveActions), all(caveItems), all(caveEvents)},
+};
+static const uint32_t kLandscapes = static_cast<uint32_t>(std::size(landscapes));
+
+// ------------ Items and recipes ------------
+
+struct ItemText {
+    const char* name;
+    const char* description;
+    const char* use;
+};
+
+static const ItemText itemTexts[] = {
+    {"branch", "A sturdy branch, dry enough to burn.", "You swing the branch at nothing in particular."},
+    {"berries", "A handful of dark berries.", "You eat a few. Tart, but good."},
+    {"mushroom", "A pale mushroom with a brown cap.", "Better not eat it."},
+    {"pinecone", "A resinous pinecone.", ""},
+    {"feather", "A long grey feather.", "You tickle your own nose with it."},
+    {"beeswax", "A lump of golden beeswax.", "It softens in your warm hand."},
+    {"herbs", "A bundle of fragrant herbs.", "Chewing the herbs leaves a pleasant taste."},
+    {"reeds", "A sheaf of tough green reeds.", ""},
+    {"clay", "A lump of grey clay.", "You roll it into a ball and back."},
+    {"bone", "An old bone, picked clean.", ""},
+    {"stone", "A smooth stone.", "You weigh it in your hand."},
+    {"flint", "A sharp flake of flint.", "Sparks fly when you strike it."},
+    {"shell", "A spiral shell.", "You hear the sea in it."},
+    {"driftwood", "A twisted piece of sea-bleached wood.", ""},
+    {"glass shard", "A shard of sea-green glass.", ""},
+    {"cloth", "A strip of cloth.", "You fold the cloth neatly."},
+    {"iron scrap", "A rusty piece of iron.", ""},
+    {"coin", "An old coin, its face worn away.", "You flip it. Heads."},
+    {"torch", "A torch of branch and cloth.", "The torch crackles and throws long shadows."},
+    {"rope", "A coil of rope twisted from reeds.", ""},
+    {"hook", "An iron hook, roughly shaped.", ""},
+    {"grapnel", "A hook on a rope, good for climbing.", "You whirl the grapnel but find nothing to catch on."},
+    {"candle", "A stubby candle.", ""},
+    {"lantern", "A lantern of glass and iron with a candle inside.", "The lantern glows warmly."},
+    {"salve", "A pot of herbal salve.", "It soothes your scrapes."},
+    {"charcoal", "A stick of charcoal.", "You draw a little map on the back of your hand."},
+    {"ink", "A small pot of black ink.", ""},
+    {"fishing rod", "A rod of branch, line and hook.", "You cast, but nothing bites."},
+};
+
+struct RecipeText {
+    const char* output;
+    uint32_t yield;
+    const char* text;
+    struct { const char* item; uint32_t count; } inputs[3]; // unused ones have no item
+};
+
+// Chains: reeds make rope, scrap makes a hook, and the two make a grapnel or
+// with a branch a fishing rod; wax makes a candle for a lantern; a branch
+// burnt with flint makes charcoal for ink
+static const RecipeText recipeTexts[] = {
+    {"torch", 1, "You bind the cloth around the branch.", {{"branch", 1}, {"cloth", 1}, {}}},
+    {"rope", 1, "You twist the reeds into rope.", {{"reeds", 3}, {}, {}}},
+    {"hook", 1, "You hammer the scrap into a hook against the stone.", {{"iron scrap", 1}, {"stone", 1}, {}}},
+    {"grapnel", 1, "You knot the rope to the hook.", {{"rope", 1}, {"hook", 1}, {}}},
+    {"fishing rod", 1, "You rig a line from the branch.", {{"branch", 1}, {"rope", 1}, {"hook", 1}}},
+    {"candle", 1, "You wrap the wax around a wick of cloth.", {{"beeswax", 1}, {"cloth", 1}, {}}},
+    {"lantern", 1, "You fit the candle into a frame of scrap and glass.", {{"candle", 1}, {"glass shard", 1}, {"iron scrap", 1}}},
+    {"salve", 1, "You pound the herbs into the clay.", {{"herbs", 2}, {"clay", 1}, {}}},
+    {"charcoal", 2, "You char the branches over a flint-struck fire.", {{"branch", 2}, {"flint", 1}, {}}},
+    {"ink", 1, "You grind the charcoal into berry juice.", {{"charcoal", 1}, {"berries", 1}, {}}},
+};
+
+// ------------ NPCs ------------
+
+struct Role {
+    const char* greeting;
+    const char* news;
+    // A trade, if the role offers one: wants is taken for gives
+    const char* wants;
+    const char* gives;
+    const char* tradePrompt;
+    const char* tradeReply;
+};
+
+static const Role roles[] = {
+    {"A woodcutter rests on the handle of an axe.", "The deep woods are no place to be after dark.",
+     "coin", "branch", "Could you spare some wood for a coin?", "Here, take a good dry branch."},
+    {"An herbalist sorts leaves into little piles.", "Herbs pounded into clay make a salve for scrapes.",
+     "mushroom", "salve", "Will you trade for this mushroom?", "A fine one. Here, have some salve."},
+    {"A fisher sits mending a net.", "The tide has been strange of late.",
+     "shell", "rope", "Would you take a shell for some rope?", "Pretty thing. The rope's yours."},
+    {"A travelling smith squints at you over a pack of tools.", "A bit of scrap and a stone make a fair hook.",
+     "iron scrap", "hook", "Can you make something of this scrap?", "A few blows and there's your hook."},
+    {"A chandler smelling of wax nods to you.", "Candles are easy. Lanterns take glass and iron besides.",
+     "beeswax", "candle", "Would you make a candle from this wax?", "Done, and a good one."},
+    {"A pilgrim in a dusty cloak bows.", "I walk to the old shrines, one after another.",
+     nullptr, nullptr, nullptr, nullptr},
+    {"A hunter watches you without blinking.", "Locked doors out here want keys, and the keys are never far away.",
+     nullptr, nullptr, nullptr, nullptr},
+    {"A scholar peers at you through thick spectacles.", "Charcoal and berries make a passable ink.",
+     "berries", "ink", "Would berries buy me some ink?", "They would. Mind you don't spill it."},
+};
+
+static const char* const npcNames[] = {
+    "edda", "wulf", "maren", "osric", "hild", "bram", "sigrun", "tamsin", "aldo", "brenna",
+    "cuthbert", "dagny", "elric", "fenna", "godric", "helga", "ivo", "jorun", "kestrel", "leofric",
+    "mab", "njal", "odile", "piers", "quenby", "rowan", "sabine", "thane", "ulla", "vesna",
+    "wystan", "yara"};
+
+// ------------ Locks ------------
+
+static const char* const keyMetals[] = {"iron", "brass", "bronze", "copper", "bone", "silver"};
+
+// ------------ Generation ------------
+
+// Where rooms are: on a grid width rooms across, filled row by row, with
+// structural choices hashed from the seed and room alone so any chunk can
+// work out any room's passages
+struct Layout {
+    uint64_t seed = 0;
+    uint32_t rooms = 0;
+    uint32_t width = 1;
+    uint32_t regionsAcross = 1;
+
+    uint64_t roll(RoomId r, uint64_t salt) const { return mix(seed ^ (r * 0x9E3779B97F4A7C15ull) ^ salt); }
+
+    // Every room but the first opens one passage towards it, north or west,
+    // which makes the passages a maze in which every path to the start only
+    // ever goes north and west
+    bool opensNorth(RoomId r) const {
+        if (r < width) return false;
+        if (r % width == 0) return true;
+        return roll(r, 1) & 1;
+    }
+    RoomId parent(RoomId r) const { return opensNorth(r) ? r - width : r - 1; }
+    // A second passage the other way, closing a loop
+    bool loops(RoomId r) const { return r >= width && r % width != 0 && roll(r, 2) % kLoopOdds == 0; }
+    // The door into r from the room north of it is locked
+    bool locked(RoomId r) const { return opensNorth(r) && roll(r, 3) % kLockOdds == 0; }
+
+    // Region 0 is the builder's default, so the grid's start at 1
+    uint32_t region(RoomId r) const {
+        return (r / width / kRegionSide) * regionsAcross + r % width / kRegionSide + 1;
+    }
+    uint32_t landscape(uint32_t region) const { return static_cast<uint32_t>(mix(seed ^ region) % kLandscapes); }
+};
+
+// Names interned up front, since the symbol table is not safe to grow from
+// several threads
+struct Vocabulary {
+    Symbol north, south, east, west, door, unlockDoor;
+    std::vector<std::vector<Symbol>> items, pois, actions; // per landscape, as in its tables
+    std::vector<Symbol> npcNames;
+};
+
+// One chunk of rooms, generated on its own and added to the builder later
+struct Chunk {
+    struct Placed { RoomId room; Symbol name; const char* text; };
+    struct Npc { RoomId home; uint32_t name, role; bool scheduled; uint32_t stays[3]; };
+    struct Lock { RoomId door, keyRoom; };
+
+    std::string text;             // every room's key, name and description
+    std::vector<uint32_t> textAt; // where each of them starts, and the end
+    std::vector<Placed> items, pois, actions;
+    std::vector<Npc> npcs;
+    std::vector<Lock> locks;
+
+    void clear() {
+        text.clear();
+        textAt.clear();
+        items.clear();
+        pois.clear();
+        actions.clear();
+        npcs.clear();
+        locks.clear();
+    }
+};
+
+// Common items are far more likely than rare ones: the k-th is picked with
+// weight 1 / (k + 1)
+static uint32_t pickItem(Rng& rng, uint32_t count) {
+    const uint32_t weights = 420; // divisible by 1..7
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < count; ++k) total += weights / (k + 1);
+    uint32_t at = rng.below(total);
+    for (uint32_t k = 0;; ++k) {
+        if (at < weights / (k + 1)) return k;
+        at -= weights / (k + 1);
+    }
+}
+
+static void generateChunk(const Layout& layout, const Vocabulary& words, size_t index, Chunk& out) {
+    out.clear();
+    Rng rng(mix(layout.seed + 0x9E3779B97F4A7C15ull * (index + 1)));
+    const RoomId first = static_cast<RoomId>(index * kChunk);
+    const RoomId last = static_cast<RoomId>(std::min<size_t>(layout.rooms, first + kChunk));
+    for (RoomId r = first; r < last; ++r) {
+        const uint32_t l = layout.landscape(layout.region(r));
+        const Landscape& land = landscapes[l];
+        auto pick = [&rng](auto table) { return table[rng.below(static_cast<uint32_t>(table.size()))]; };
+
+        out.textAt.push_back(static_cast<uint32_t>(out.text.size()));
+        out.text += 'r';
+        out.text += std::to_string(r);
+        out.textAt.push_back(static_cast<uint32_t>(out.text.size()));
+        out.text += pick(land.adjectives);
+        out.text += ' ';
+        out.text += pick(land.nouns);
+        out.textAt.push_back(static_cast<uint32_t>(out.text.size()));
+        out.text += pick(land.openings);
+        out.text += ' ';
+        out.text += pick(land.details);
+
+        // Half the rooms hold nothing, a few hold three things
+        const uint32_t roll = rng.below(20);
+        const uint32_t items = roll < 10 ? 0 : roll < 16 ? 1 : roll < 19 ? 2 : 3;
+        for (uint32_t i = 0; i < items; ++i)
+            out.items.push_back({r, words.items[l][pickItem(rng, static_cast<uint32_t>(land.items.size()))], nullptr});
+
+        // One to three points of interest, all different
+        const uint32_t pois = 1 + rng.below(3);
+        const uint32_t firstPoi = rng.below(static_cast<uint32_t>(land.pois.size()));
+        for (uint32_t i = 0; i < pois; ++i) {
+            const uint32_t p = (firstPoi + i) % land.pois.size();
+            out.pois.push_back({r, words.pois[l][p], land.pois[p].text});
+        }
+        if (rng.below(5) < 2) {
+            const uint32_t a = rng.below(static_cast<uint32_t>(land.actions.size()));
+            out.actions.push_back({r, words.actions[l][a], land.actions[a].text});
+        }
+
+        if (rng.below(kNpcOdds) == 0) {
+            Chunk::Npc npc{r, rng.below(static_cast<uint32_t>(std::size(npcNames))),
+                           rng.below(static_cast<uint32_t>(std::size(roles))), r != 0 && rng.below(2) == 0, {}};
+            for (uint32_t& stay : npc.stays) stay = 4 + rng.below(13);
+            out.npcs.push_back(npc);
+        }
+
+        // The key lies in a room numbered lower than r, somewhere in the two
+        // rows before it. Those rooms are never behind this door.
+        if (layout.locked(r)) {
+            const RoomId door = r - layout.width;
+            out.locks.push_back({door, r - 1 - rng.below(std::min(r, 2 * layout.width))});
+        }
+    }
+    out.textAt.push_back(static_cast<uint32_t>(out.text.size()));
+}
+
+// Adds one chunk of rooms, their passages and everything in them
+static void addChunk(const Layout& layout, const Vocabulary& words, size_t index, const Chunk& chunk,
+                     WorldBuilder& builder, GenerateReport& report) {
+    const RoomId first = static_cast<RoomId>(index * kChunk);
+    const RoomId last = static_cast<RoomId>(std::min<size_t>(layout.rooms, first + kChunk));
+    auto text = [&chunk](size_t i) {
+        return std::string_view(chunk.text).substr(chunk.textAt[i], chunk.textAt[i + 1] - chunk.textAt[i]);
+    };
+    for (RoomId r = first; r < last; ++r) {
+        const size_t t = (r - first) * 3;
+        builder.addRoom(text(t), text(t + 1), text(t + 2));
+        builder.setRoomRegion(r, layout.region(r));
+    }
+
+    // Each room adds the passage it opens, both ways, and its loop if it has one
+    size_t keys = report.lockedExits; // numbered in the order their doors are added
+    for (RoomId r = first; r < last; ++r) {
+        if (r == 0) continue;
+        const bool north = layout.opensNorth(r);
+        if (north) {
+            builder.addExit(r, words.north, r - layout.width);
+            builder.addExit(r - layout.width, words.south, r, layout.locked(r));
+        } else {
+            builder.addExit(r, words.west, r - 1);
+            builder.addExit(r - 1, words.east, r);
+        }
+        report.exits += 2;
+        report.lockedExits += layout.locked(r);
+        if (layout.loops(r)) {
+            if (north) {
+                builder.addExit(r, words.west, r - 1);
+                builder.addExit(r - 1, words.east, r);
+            } else {
+                builder.addExit(r, words.north, r - layout.width);
+                builder.addExit(r - layout.width, words.south, r);
+            }
+            report.exits += 2;
+        }
+    }
+
+    for (const Chunk::Placed& p : chunk.items) builder.addItem(p.room, p.name);
+    for (const Chunk::Placed& p : chunk.pois) builder.addPointOfInterest(p.room, p.name, p.text);
+    for (const Chunk::Placed& p : chunk.actions) builder.addAction(p.room, p.name, p.text);
+    report.items += chunk.items.size();
+    report.pointsOfInterest += chunk.pois.size();
+    report.actions += chunk.actions.size();
+
+    for (const Chunk::Npc& n : chunk.npcs) {
+        const Role& role = roles[n.role];
+        const uint32_t npc = builder.addNpc(words.npcNames[n.name], role.greeting);
+        builder.placeNpc(n.home, npc);
+        if (n.scheduled) {
+            // Home and the next two rooms towards the start
+            RoomId at = n.home;
+            for (uint32_t s = 0; s < 3; ++s) {
+                builder.addScheduleStop(npc, at, n.stays[s]);
+                if (at == 0) break;
+                at = layout.parent(at);
+            }
+        }
+        const uint32_t node = builder.npcStartNode(npc);
+        builder.addDialogueOption(node, "What news?", role.news);
+        if (role.wants) {
+            const uint32_t trade = builder.addDialogueOption(node, role.tradePrompt, role.tradeReply);
+            builder.addOptionTest(trade, RuleCarrying, intern(role.wants));
+            builder.addOptionEffect(trade, RuleTake, intern(role.wants));
+            builder.addOptionEffect(trade, RuleGive, intern(role.gives));
+        }
+        const uint32_t farewell = builder.addDialogueOption(node, "Farewell", "They nod and turn back to what they were doing.");
+        builder.setOptionTarget(farewell, kNoNode);
+    }
+    report.npcs += chunk.npcs.size();
+
+    // A numbered key for each door, and rules in the room before it to open it
+    std::string name, line;
+    for (const Chunk::Lock& lock : chunk.locks) {
+        const std::string number = std::to_string(++keys);
+        const char* metal = keyMetals[lock.door % std::size(keyMetals)];
+        name.assign(metal).append(" key ").append(number);
+        const Symbol key = intern(name);
+        builder.addItem(lock.keyRoom, key);
+        ++report.items;
+        line.assign("A ").append(metal).append(" key on a tag marked ").append(number).append(".");
+        builder.setItemInfo(key, line, "It must open a door somewhere.");
+
+        builder.addPointOfInterest(lock.door, words.door, "A heavy door bars the way south.");
+        builder.addAction(lock.door, words.unlockDoor);
+        uint32_t rule = builder.addRule(lock.door, words.unlockDoor);
+        builder.addRuleTest(rule, RuleExitOpen, words.south);
+        builder.addRuleEffect(rule, RuleSay, 0, "The door is already open.");
+        rule = builder.addRule(lock.door, words.unlockDoor);
+        builder.addRuleTest(rule, RuleCarrying, key);
+        builder.addRuleEffect(rule, RuleUnlock, words.south);
+        line.assign("The ").append(metal).append(" key turns and the door swings open.");
+        builder.addRuleEffect(rule, RuleSay, 0, line);
+        rule = builder.addRule(lock.door, words.unlockDoor);
+        line.assign("The door is locked. Its keyhole is marked ").append(number).append(".");
+        builder.addRuleEffect(rule, RuleSay, 0, line);
+    }
+}
+
+GenerateReport generateWorld(const GenerateOptions& options, WorldBuilder& builder) {
+    using Clock = std::chrono::steady_clock;
+    const auto begin = Clock::now();
+    GenerateReport report;
+
+    Layout layout;
+    layout.seed = options.seed;
+    layout.rooms = static_cast<uint32_t>(std::max<size_t>(options.rooms, 1));
+    layout.width = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(layout.rooms)))));
+    layout.regionsAcross = (layout.width + kRegionSide - 1) / kRegionSide;
+    const uint32_t rows = (layout.rooms + layout.width - 1) / layout.width;
+    const uint32_t regions = layout.regionsAcross * ((rows + kRegionSide - 1) / kRegionSide);
+
+    // Most prose comes from the tables above, so store each piece once
+    builder.shareText();
+
+    Vocabulary words;
+    words.north = intern("north");
+    words.south = intern("south");
+    words.east = intern("east");
+    words.west = intern("west");
+    words.door = intern("door");
+    words.unlockDoor = intern("unlock door");
+    for (const Landscape& land : landscapes) {
+        words.items.emplace_back();
+        for (const char* item : land.items) words.items.back().push_back(intern(item));
+        words.pois.emplace_back();
+        for (const Named& poi : land.pois) words.pois.back().push_back(intern(poi.name));
+        words.actions.emplace_back();
+        for (const Named& action : land.actions) words.actions.back().push_back(intern(action.name));
+    }
+    for (const char* name : npcNames) words.npcNames.push_back(intern(name));
+
+    for (const ItemText& item : itemTexts) builder.setItemInfo(intern(item.name), item.description, item.use);
+    for (const RecipeText& r : recipeTexts) {
+        const uint32_t recipe = builder.addRecipe(intern(r.output), r.yield, r.text);
+        for (const auto& input : r.inputs)
+            if (input.item) builder.addRecipeInput(recipe, intern(input.item), input.count);
+    }
+    report.recipes = std::size(recipeTexts);
+
+    // Regions in grid order, so region i + 1 is the builder's region i + 1,
+    // each with an event from its landscape
+    for (uint32_t region = 1; region <= regions; ++region) {
+        const Landscape& land = landscapes[layout.landscape(region)];
+        builder.addRegion(std::string(land.name) + "-" + std::to_string(region));
+        const uint64_t roll = mix(options.seed ^ (0x51ED27ull * region));
+        builder.addEvent(region, 12 + static_cast<uint32_t>(roll % 25),
+                         land.events[static_cast<size_t>(roll >> 32) % land.events.size()]);
+    }
+    report.regions = regions;
+
+    // A batch of chunks at a time: generated in parallel, then added in order
+    const size_t chunks = (layout.rooms + kChunk - 1) / kChunk;
+    const size_t batch = options.pool ? std::max<size_t>(options.pool->size() * 2, 1) : 1;
+    std::vector<Chunk> made(std::min(batch, chunks));
+    for (size_t first = 0; first < chunks; first += batch) {
+        const size_t count = std::min(batch, chunks - first);
+        auto work = [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) generateChunk(layout, words, first + c, made[c]);
+        };
+        if (options.pool) options.pool->run(count, 1, work);
+        else work(0, count);
+        for (size_t c = 0; c < count; ++c) addChunk(layout, words, first + c, made[c], builder, report);
+    }
+    builder.setStartRoom(0);
+
+    report.rooms = layout.rooms;
+    report.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return report;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "pool.h"
+#include "world.h"
+
+struct GenerateOptions {
+    size_t rooms = 100000;
+    uint64_t seed = 0;
+    WorkPool* pool = nullptr; // generates in parallel when given
+};
+
+// What went into a generated world
+struct GenerateReport {
+    size_t rooms = 0;
+    size_t exits = 0;
+    size_t lockedExits = 0;
+    size_t items = 0; // placed in rooms, keys included
+    size_t pointsOfInterest = 0;
+    size_t actions = 0;
+    size_t npcs = 0;
+    size_t recipes = 0;
+    size_t regions = 0;
+    double seconds = 0;
+};
+
+// Makes up a world of any size for soak testing. Rooms sit on a square grid
+// whose passages form a maze rooted at the start room (room 0), with a few
+// extra passages making loops. Regions are 32x32 blocks of the grid, each in
+// one of a handful of landscapes that supply its rooms' names, descriptions,
+// points of interest, actions and items; common items turn up far more often
+// than rare ones. About one room in 64 has an NPC, half of them walking a
+// schedule, and some offering trades. About one passage north in 128 is a
+// locked door whose numbered key lies in a lower-numbered room: every room
+// on the way there from the start is lower-numbered too, so the doors can
+// always be opened in order. A fixed set of recipes chains the landscapes'
+// items into tools.
+//
+// Rooms are generated in chunks on the pool, a few chunks per thread at a
+// time, and each batch of chunks is added to builder before the next one
+// starts, so only the builder ever holds the whole world. The same seed and
+// room count always give the same world, whatever the pool.
+GenerateReport generateWorld(const GenerateOptions& options, WorldBuilder& builder);
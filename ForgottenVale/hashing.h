@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility> // std::pair
+#include <vector>
+
+#include "span.h"
+
+// splitmix64 finaliser: every bit of x affects every bit of the result, and
+// distinct inputs give distinct outputs
+inline uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+// Read-only table from 64-bit keys to runs of values. Every key hashes to one
+// slot holding its values in the order they were given, so a lookup is a
+// single probe (plus a short linear scan on a collision) however many keys
+// there are. Keys pick their slot by their low bits, so they should already
+// be well mixed; mix() does that for keys that aren't.
+template <typename T>
+struct KeyedRanges {
+    // entries must be sorted by key; values sharing a key keep their order
+    void build(const std::vector<std::pair<uint64_t, T>>& entries) {
+        size_t keys = 0;
+        for (size_t i = 0; i < entries.size(); ++i)
+            if (i == 0 || entries[i].first != entries[i - 1].first) ++keys;
+        size_t capacity = 16;
+        while (capacity < keys * 2) capacity *= 2;
+        slots.assign(capacity, Slot{});
+        values.clear();
+        values.reserve(entries.size());
+        for (size_t i = 0; i < entries.size();) {
+            Slot slot;
+            slot.key = entries[i].first;
+            slot.begin = static_cast<uint32_t>(values.size());
+            for (; i < entries.size() && entries[i].first == slot.key; ++i) values.push_back(entries[i].second);
+            slot.end = static_cast<uint32_t>(values.size());
+            size_t pos = slot.key & (capacity - 1);
+            while (slots[pos].begin != slots[pos].end) pos = (pos + 1) & (capacity - 1);
+            slots[pos] = slot;
+        }
+    }
+
+    bool empty() const { return values.empty(); }
+
+    // Values filed under key, in order; empty if there are none
+    Span<T> find(uint64_t key) const {
+        if (slots.empty()) return {};
+        size_t pos = key & (slots.size() - 1);
+        while (slots[pos].begin != slots[pos].end && slots[pos].key != key)
+            pos = (pos + 1) & (slots.size() - 1);
+        const Slot& slot = slots[pos];
+        return {values.data() + slot.begin, values.data() + slot.end};
+    }
+
+private:
+    struct Slot {
+        uint64_t key = 0;
+        uint32_t begin = 0; // range into values
+        uint32_t end = 0;   // empty slot when begin == end
+    };
+
+    std::vector<T> values;   // grouped by key
+    std::vector<Slot> slots; // open addressing, size is a power of two
+};
@@ -0,0 +1,149 @@
+#include "items.h"
+
+#include <algorithm> // std::min, std::max, std::remove_if
+
+ItemSet::Iterator& ItemSet::Iterator::operator++() {
+    do ++at; while (at != last && at->count == 0);
+    return *this;
+}
+
+ItemSet& ItemSet::operator=(const ItemSet& other) {
+    if (this == &other) return *this;
+    if (stacks.capacity() < std::max(other.stacks.size(), size_t{kLinearLimit}))
+        stacks.reserve(std::max(2 * other.stacks.size(), size_t{kLinearLimit}));
+    stacks.assign(other.stacks.begin(), other.stacks.end());
+    slots = other.slots;
+    live = other.live;
+    slotsUsed = other.slotsUsed;
+    return *this;
+}
+
+ItemSet::Iterator ItemSet::begin() const {
+    Iterator it{stacks.data(), stacks.data() + stacks.size()};
+    while (it.at != it.last && it.at->count == 0) ++it.at;
+    return it;
+}
+
+ItemSet::Iterator ItemSet::end() const {
+    return {stacks.data() + stacks.size(), stacks.data() + stacks.size()};
+}
+
+size_t ItemSet::probe(Symbol item) const {
+    const size_t mask = slots.size() - 1;
+    size_t i = (item * 2654435769u) & mask; // Fibonacci hashing
+    while (slots[i] != 0 && stacks[slots[i] - 1].item != item) i = (i + 1) & mask;
+    return i;
+}
+
+size_t ItemSet::find(Symbol item) const {
+    if (slots.empty()) {
+        // Newest first, so a stack emptied earlier never hides a live one
+        for (size_t i = stacks.size(); i-- > 0;) {
+            if (stacks[i].item == item) return i;
+        }
+        return npos;
+    }
+    const uint32_t s = slots[probe(item)];
+    return s == 0 ? npos : s - 1;
+}
+
+uint32_t ItemSet::count(Symbol item) const {
+    const size_t pos = find(item);
+    return pos == npos ? 0 : stacks[pos].count;
+}
+
+void ItemSet::add(Symbol item, uint32_t n) {
+    if (n == 0) return;
+    const size_t pos = find(item);
+    if (pos != npos && stacks[pos].count != 0) {
+        stacks[pos].count += n;
+        return;
+    }
+    // Room for a short list at once, rather than growing one stack at a
+    // time, and the room of dead stacks is taken back before growing
+    if (stacks.capacity() == 0) stacks.reserve(kLinearLimit);
+    else if (stacks.size() == stacks.capacity() && live < stacks.size()) rebuild();
+    stacks.push_back({item, n});
+    ++live;
+    if (slots.empty()) {
+        if (stacks.size() > kLinearLimit) rebuild();
+        return;
+    }
+    uint32_t& s = slots[probe(item)];
+    if (s == 0) ++slotsUsed;
+    s = static_cast<uint32_t>(stacks.size());
+    if (slotsUsed * 2 > slots.size()) rebuild();
+}
+
+uint32_t ItemSet::remove(Symbol item, uint32_t n) {
+    const size_t pos = find(item);
+    if (pos == npos) return 0;
+    ItemStack& stack = stacks[pos];
+    const uint32_t taken = std::min(n, stack.count);
+    if (taken == 0) return 0;
+    stack.count -= taken;
+    if (stack.count == 0) {
+        --live;
+        if (stacks.size() > kLinearLimit && stacks.size() - live > live) rebuild();
+    }
+    return taken;
+}
+
+void ItemSet::clear() {
+    stacks.clear();
+    slots.clear();
+    live = 0;
+    slotsUsed = 0;
+}
+
+void ItemSet::rebuild() {
+    stacks.erase(std::remove_if(stacks.begin(), stacks.end(),
+                                [](const ItemStack& s) { return s.count == 0; }),
+                 stacks.end());
+    slotsUsed = 0;
+    if (stacks.size() <= kLinearLimit) {
+        slots.clear();
+        return;
+    }
+    size_t capacity = 16;
+    while (capacity < stacks.size() * 4) capacity *= 2;
+    slots.assign(capacity, 0);
+    for (size_t i = 0; i < stacks.size(); ++i) {
+        slots[probe(stacks[i].item)] = static_cast<uint32_t>(i + 1);
+        ++slotsUsed;
+    }
+}
+
+bool ItemSet::operator==(const ItemSet& other) const {
+    if (live != other.live) return false;
+    Iterator a = begin(), b = other.begin();
+    for (; a != end(); ++a, ++b) {
+        if (a->item != b->item || a->count != b->count) return false;
+    }
+    return true;
+}
+
+ItemSet::Iterator ItemList::begin() const {
+    return set ? set->begin() : ItemSet::Iterator{stacks.first, stacks.last};
+}
+
+ItemSet::Iterator ItemList::end() const {
+    return set ? set->end() : ItemSet::Iterator{stacks.last, stacks.last};
+}
+
+uint32_t ItemList::count(Symbol item) const {
+    if (set) return set->count(item);
+    for (const ItemStack& stack : stacks) {
+        if (stack.item == item) return stack.count;
+    }
+    return 0;
+}
+
+bool ItemList::operator==(const ItemList& other) const {
+    ItemSet::Iterator a = begin(), b = other.begin();
+    const ItemSet::Iterator aEnd = end(), bEnd = other.end();
+    for (; a != aEnd && b != bEnd; ++a, ++b) {
+        if (a->item != b->item || a->count != b->count) return false;
+    }
+    return a == aEnd && b == bEnd;
+}
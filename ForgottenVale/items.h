@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "span.h"
+#include "symbols.h"
+
+// Some number of one item
+struct ItemStack {
+    Symbol item = kNoSymbol;
+    uint32_t count = 0;
+};
+
+// Items carried by the player or lying in a room, stacked by item. Checking,
+// adding and removing an item take constant time, and iterating lists the
+// stacks in the order their items first arrived.
+//
+// Stacks live in one array in arrival order. Emptying a stack only marks it
+// (count 0), so removal never shifts the others; the dead stacks are dropped
+// once they outnumber the live ones. Sets of up to kLinearLimit stacks, which
+// is nearly all of them, are searched directly. Larger ones also keep an
+// open-addressed table from item to its latest stack.
+struct ItemSet {
+    struct Iterator {
+        const ItemStack* at;
+        const ItemStack* last;
+
+        const ItemStack& operator*() const { return *at; }
+        const ItemStack* operator->() const { return at; }
+        Iterator& operator++();
+        bool operator!=(const Iterator& other) const { return at != other.at; }
+        bool operator==(const Iterator& other) const { return at == other.at; }
+    };
+
+    ItemSet() = default;
+    ItemSet(const ItemSet&) = default;
+    ItemSet(ItemSet&&) = default;
+    ItemSet& operator=(ItemSet&&) = default;
+    // Reuses what this set holds, and always leaves room for at least a
+    // short list, so sets that are copied over again and again, like those
+    // in recycled checkpoint nodes, stop allocating once they have been
+    // copied into once
+    ItemSet& operator=(const ItemSet& other);
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    // Number of distinct items
+    size_t size() const { return live; }
+    bool empty() const { return live == 0; }
+
+    uint32_t count(Symbol item) const;
+    bool contains(Symbol item) const { return count(item) != 0; }
+
+    void add(Symbol item, uint32_t n = 1);
+    // Removes up to n of item and returns how many were removed
+    uint32_t remove(Symbol item, uint32_t n = 1);
+    // Empties the set, keeping what it has allocated
+    void clear();
+    // Makes room for this many stacks
+    void reserve(size_t count) { stacks.reserve(count); }
+
+    // Same stacks in the same order
+    bool operator==(const ItemSet& other) const;
+    bool operator!=(const ItemSet& other) const { return !(*this == other); }
+
+    static const size_t kLinearLimit = 8;
+
+private:
+    // Position of the latest stack of item, or npos
+    size_t find(Symbol item) const;
+    // Slot holding item's latest stack, or the free slot where it would go
+    size_t probe(Symbol item) const;
+    // Drops dead stacks and sizes the table for what is left
+    void rebuild();
+
+    static const size_t npos = SIZE_MAX;
+
+    std::vector<ItemStack> stacks;
+    std::vector<uint32_t> slots; // position in stacks + 1, 0 if free; power-of-two size
+    size_t live = 0;
+    size_t slotsUsed = 0;
+};
+
+// Stacks to read: an ItemSet's, or a run already stacked one per item, such as
+// a room's starting items in a world image. Runs are searched directly, so
+// they should be short.
+struct ItemList {
+    ItemList(const ItemSet& set) : set(&set) {}
+    ItemList(Span<ItemStack> stacks) : stacks(stacks) {}
+
+    ItemSet::Iterator begin() const;
+    ItemSet::Iterator end() const;
+    bool empty() const { return set ? set->empty() : stacks.empty(); }
+
+    uint32_t count(Symbol item) const;
+    bool contains(Symbol item) const { return count(item) != 0; }
+
+    // Same stacks in the same order
+    bool operator==(const ItemList& other) const;
+    bool operator!=(const ItemList& other) const { return !(*this == other); }
+
+private:
+    const ItemSet* set = nullptr;
+    Span<ItemStack> stacks;
+};
@@ -0,0 +1,176 @@
+#include "npcs.h"
+
+#include <algorithm> // std::nth_element, std::max, std::upper_bound
+#include <atomic>
+#include <chrono>
+
+#include "pool.h"
+#include "rng.h"
+
+NpcSchedules npcSchedules(const World& world) {
+    NpcSchedules s;
+    s.home = world.npcHome;
+    s.stopStart = world.npcStopStart;
+    s.stopRoom = world.stopRoom;
+    s.stopStay = world.stopStay;
+    return s;
+}
+
+// ------------ RoomSlots ------------
+
+void RoomSlots::reset(size_t capacity) {
+    // At most half full
+    size_t size = 16;
+    while (size < 2 * capacity) size *= 2;
+    table.assign(size, 0);
+    rooms.clear();
+}
+
+uint32_t RoomSlots::find(RoomId room) const {
+    if (table.empty()) return kNone;
+    const size_t mask = table.size() - 1;
+    for (size_t i = (room * 2654435769u) & mask;; i = (i + 1) & mask) { // Fibonacci hashing
+        if (table[i] == 0) return kNone;
+        if (rooms[table[i] - 1] == room) return table[i] - 1;
+    }
+}
+
+uint32_t RoomSlots::add(RoomId room) {
+    const size_t mask = table.size() - 1;
+    for (size_t i = (room * 2654435769u) & mask;; i = (i + 1) & mask) {
+        if (table[i] == 0) {
+            rooms.push_back(room);
+            table[i] = static_cast<uint32_t>(rooms.size());
+            return table[i] - 1;
+        }
+        if (rooms[table[i] - 1] == room) return table[i] - 1;
+    }
+}
+
+// ------------ NpcPlaces ------------
+
+void NpcPlaces::build(const NpcSchedules& with) {
+    schedules = with;
+    const size_t npcs = schedules.home.size();
+
+    // Every NPC counts once for each room it can be in: its stops, or its
+    // home if it has no schedule
+    slots.reset(npcs + schedules.stopRoom.size());
+    std::vector<uint32_t> stopSlot(schedules.stopRoom.size());
+    std::vector<uint32_t> homeSlot(npcs, RoomSlots::kNone);
+    for (size_t n = 0; n < npcs; ++n) {
+        const uint32_t s0 = schedules.stopStart[n], s1 = schedules.stopStart[n + 1];
+        if (s0 == s1 && schedules.home[n] != kNoRoom) homeSlot[n] = slots.add(schedules.home[n]);
+        for (uint32_t s = s0; s < s1; ++s) stopSlot[s] = slots.add(schedules.stopRoom[s]);
+    }
+    std::vector<uint32_t> last(slots.size(), UINT32_MAX); // the NPC last counted in each
+    auto visits = [&](auto&& visit) {
+        std::fill(last.begin(), last.end(), UINT32_MAX);
+        for (uint32_t n = 0; n < npcs; ++n) {
+            const uint32_t s0 = schedules.stopStart[n], s1 = schedules.stopStart[n + 1];
+            if (homeSlot[n] != RoomSlots::kNone) visit(homeSlot[n], n);
+            for (uint32_t s = s0; s < s1; ++s) {
+                if (last[stopSlot[s]] == n) continue; // back to a room already counted
+                last[stopSlot[s]] = n;
+                visit(stopSlot[s], n);
+            }
+        }
+    };
+    visitorStart.assign(slots.size() + 1, 0);
+    visits([&](uint32_t slot, uint32_t) { ++visitorStart[slot + 1]; });
+    for (size_t s = 0; s < slots.size(); ++s) visitorStart[s + 1] += visitorStart[s];
+    visitors.resize(visitorStart.back());
+    std::vector<uint32_t> fill(visitorStart.begin(), visitorStart.end() - 1);
+    visits([&](uint32_t slot, uint32_t n) { visitors[fill[slot]++] = n; });
+
+    stopEnd.resize(schedules.stopRoom.size());
+    for (size_t n = 0; n < npcs; ++n) {
+        uint64_t end = 0;
+        for (uint32_t s = schedules.stopStart[n]; s < schedules.stopStart[n + 1]; ++s)
+            stopEnd[s] = end += schedules.stopStay[s];
+    }
+}
+
+// The schedule repeats every sum-of-stays ticks, counted from tick 0
+RoomId NpcPlaces::where(uint32_t npc, uint32_t tick) const {
+    const uint32_t s0 = schedules.stopStart[npc], s1 = schedules.stopStart[npc + 1];
+    if (s0 == s1) return schedules.home[npc];
+    const uint64_t into = tick % stopEnd[s1 - 1];
+    const uint64_t* s = std::upper_bound(stopEnd.data() + s0, stopEnd.data() + s1, into);
+    return schedules.stopRoom[static_cast<size_t>(s - stopEnd.data())];
+}
+
+void NpcPlaces::in(RoomId room, uint32_t tick, std::vector<uint32_t>& out) const {
+    out.clear();
+    const uint32_t slot = slots.find(room);
+    if (slot == RoomSlots::kNone) return;
+    for (uint32_t i = visitorStart[slot]; i < visitorStart[slot + 1]; ++i)
+        if (where(visitors[i], tick) == room) out.push_back(visitors[i]);
+}
+
+// Rooms per batch of a benchmark tick
+static const size_t kBenchBatch = 1024;
+
+NpcBenchResult benchmarkNpcs(const World& world, size_t npcs, unsigned workers, size_t ticks, uint64_t seed) {
+    Rng rng(seed);
+    const uint32_t rooms = static_cast<uint32_t>(std::max<size_t>(world.roomCount(), 1));
+    std::vector<RoomId> home(npcs);
+    std::vector<uint32_t> stopStart(npcs + 1, 0);
+    std::vector<RoomId> stopRoom;
+    std::vector<uint32_t> stopStay;
+    for (size_t n = 0; n < npcs; ++n) {
+        home[n] = rng.below(rooms);
+        const uint32_t stops = 2 + rng.below(4);
+        for (uint32_t s = 0; s < stops; ++s) {
+            stopRoom.push_back(rng.below(rooms));
+            stopStay.push_back(5 + rng.below(56));
+        }
+        stopStart[n + 1] = static_cast<uint32_t>(stopRoom.size());
+    }
+    NpcSchedules schedules;
+    schedules.home = {home.data(), home.data() + home.size()};
+    schedules.stopStart = {stopStart.data(), stopStart.data() + stopStart.size()};
+    schedules.stopRoom = {stopRoom.data(), stopRoom.data() + stopRoom.size()};
+    schedules.stopStay = {stopStay.data(), stopStay.data() + stopStay.size()};
+
+    NpcPlaces places;
+    places.build(schedules);
+    const size_t roomCount = places.roomCount();
+
+    using Clock = std::chrono::steady_clock;
+    WorkPool pool(std::max(workers, 1u));
+    NpcBenchResult result;
+    result.npcs = npcs;
+    result.rooms = roomCount;
+    result.ticks = ticks;
+    std::vector<double> latencies;
+    latencies.reserve(ticks);
+    for (uint32_t t = 1; t <= ticks; ++t) {
+        const auto begin = Clock::now();
+        std::atomic<size_t> moves{0};
+        pool.run(roomCount, kBenchBatch, [&](size_t first, size_t last) {
+            std::vector<uint32_t> was, is;
+            size_t seen = 0;
+            for (size_t i = first; i < last; ++i) {
+                const RoomId room = places.room(static_cast<uint32_t>(i));
+                places.in(room, t - 1, was);
+                places.in(room, t, is);
+                npcChanges(was, is, [&](uint32_t) { ++seen; }, [&](uint32_t) { ++seen; });
+            }
+            moves.fetch_add(seen, std::memory_order_relaxed);
+        });
+        result.moves += moves.load();
+        const auto end = Clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    }
+    if (!latencies.empty()) {
+        double total = 0;
+        for (double l : latencies) total += l;
+        result.meanMicros = total / latencies.size();
+        result.maxMicros = *std::max_element(latencies.begin(), latencies.end());
+        auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(0.99 * (latencies.size() - 1));
+        std::nth_element(latencies.begin(), nth, latencies.end());
+        result.p99Micros = *nth;
+    }
+    return result;
+}
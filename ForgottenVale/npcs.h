@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "world.h"
+
+// NPC schedules as NpcPlaces reads them (see World): the world's own, or
+// arrays made up for a benchmark
+struct NpcSchedules {
+    Span<RoomId> home;
+    Span<uint32_t> stopStart; // per NPC + 1, range into stopRoom and stopStay
+    Span<RoomId> stopRoom;
+    Span<uint32_t> stopStay;
+};
+
+NpcSchedules npcSchedules(const World& world);
+
+// The rooms that are some NPC's home or schedule stop, numbered densely
+// from 0. Slots are found through open addressing over RoomId with
+// power-of-two size, holding slot + 1 so that 0 is empty.
+struct RoomSlots {
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    // Empties it, with room for up to `rooms` rooms
+    void reset(size_t rooms);
+    // The room's slot, made if it has none
+    uint32_t add(RoomId room);
+    uint32_t find(RoomId room) const;
+    RoomId room(uint32_t slot) const { return rooms[slot]; }
+    size_t size() const { return rooms.size(); }
+
+private:
+    std::vector<RoomId> rooms;
+    std::vector<uint32_t> table;
+};
+
+// Who is where, shared by every session of a world. Schedules loop, so where
+// an NPC stands follows from the tick alone: a session asks about the room
+// it shows at its own tick, and nothing is stepped or kept per session. Only
+// the NPCs whose home or schedule takes in a room are looked at for it.
+struct NpcPlaces {
+    void build(const NpcSchedules& schedules);
+
+    // Sets out to the NPCs in room on tick, in id order
+    void in(RoomId room, uint32_t tick, std::vector<uint32_t>& out) const;
+    RoomId where(uint32_t npc, uint32_t tick) const;
+    // The rooms some NPC can be in, numbered from 0
+    size_t roomCount() const { return slots.size(); }
+    RoomId room(uint32_t i) const { return slots.room(i); }
+
+private:
+    NpcSchedules schedules;
+    RoomSlots slots;
+    // The NPCs who can be in slot s are visitors[visitorStart[s], ...),
+    // ascending
+    std::vector<uint32_t> visitorStart;
+    std::vector<uint32_t> visitors;
+    std::vector<uint64_t> stopEnd; // per stop, when its stay ends within the loop
+};
+
+// Walks two lists of NPCs in id order, such as a room's on the tick before
+// and on this one, calling left(npc) for each only in was and came(npc) for
+// each only in is
+template <typename Left, typename Came>
+void npcChanges(const std::vector<uint32_t>& was, const std::vector<uint32_t>& is, Left&& left, Came&& came) {
+    auto a = was.begin();
+    auto b = is.begin();
+    while (a != was.end() || b != is.end()) {
+        if (b == is.end() || (a != was.end() && *a < *b)) {
+            left(*a++);
+        } else if (a == was.end() || *b < *a) {
+            came(*b++);
+        } else {
+            ++a, ++b;
+        }
+    }
+}
+
+struct NpcBenchResult {
+    size_t npcs = 0;
+    size_t rooms = 0;      // rooms asked about each tick
+    size_t ticks = 0;
+    size_t moves = 0;      // arrivals and departures seen, over every tick
+    double meanMicros = 0; // per tick
+    double p99Micros = 0;
+    double maxMicros = 0;
+};
+
+// Times ticks of a made-up crowd of npcs NPCs wandering the world's rooms,
+// each with a schedule of a few stops. A tick asks NpcPlaces who left and
+// who arrived in every room any of them can be in, as a session standing
+// there would after a command, spread over a pool of `workers` threads.
+NpcBenchResult benchmarkNpcs(const World& world, size_t npcs, unsigned workers, size_t ticks, uint64_t seed);
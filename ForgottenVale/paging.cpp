@@ -0,0 +1,379 @@
+#include "paging.h"
+
+#include <algorithm> // std::sort, std::unique, std::find, std::max, std::min
+#include <cstdio>    // std::fopen, std::fgets, std::sscanf
+#include <utility>   // std::pair
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>   // QueryWorkingSetEx
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static size_t systemPageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Hands pages of a file mapping back to the system; reading them again
+// brings them back from the file
+static void dropPages(const char* first, size_t bytes) {
+#ifdef _WIN32
+    // Unlocking pages that were never locked takes them out of the working set
+    VirtualUnlock(const_cast<char*>(first), bytes);
+#else
+#ifdef MADV_PAGEOUT
+    // Unmapping alone leaves the pages cached, still taking up memory;
+    // paging them out frees them unless another process maps them too
+    ::madvise(const_cast<char*>(first), bytes, MADV_PAGEOUT);
+#endif
+    ::madvise(const_cast<char*>(first), bytes, MADV_DONTNEED);
+#endif
+}
+
+RegionPager::~RegionPager() {
+    if (!thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    thread.join();
+}
+
+void RegionPager::start(const World& paged, size_t idle) {
+    if (!paged.mapped || paged.regionCount() == 0) return;
+    world = &paged;
+    base = paged.image.get();
+    imageSize = paged.imageSize;
+    pageSize = systemPageSize();
+    idleLimit = idle;
+    const size_t regionTotal = paged.regionCount();
+    const size_t rooms = paged.roomCount();
+
+    roomStart.assign(regionTotal + 1, 0);
+    byRegion.assign(rooms, 0);
+    for (uint32_t g : paged.roomRegion) ++roomStart[g + 1];
+    for (size_t g = 0; g < regionTotal; ++g) roomStart[g + 1] += roomStart[g];
+    std::vector<uint32_t> next(roomStart.begin(), roomStart.end() - 1);
+    for (RoomId r = 0; r < rooms; ++r) byRegion[next[paged.roomRegion[r]]++] = r;
+
+    regions = std::vector<Region>(regionTotal);
+    pageUsers.assign((imageSize + pageSize - 1) / pageSize, 0);
+#ifndef _WIN32
+    ::madvise(const_cast<char*>(base), imageSize, MADV_RANDOM);
+#endif
+    thread = std::thread([this] { prefetch(); });
+}
+
+// Works out every page holding something about one of the region's rooms,
+// and the regions its exits lead to. Called with the lock held.
+void RegionPager::plan(uint32_t region) {
+    Region& g = regions[region];
+    if (g.planned) return;
+    g.planned = true;
+    const World& w = *world;
+    const uint32_t first = roomStart[region];
+    const uint32_t last = roomStart[region + 1];
+
+    // Byte ranges of the image. Each array is gone through room by room, so
+    // the slices of rooms laid out together join up as they are added.
+    std::vector<std::pair<size_t, size_t>> ranges;
+    auto add = [&](const void* at, size_t bytes) {
+        if (bytes == 0) return;
+        const size_t from = static_cast<size_t>(static_cast<const char*>(at) - base);
+        if (!ranges.empty() && ranges.back().first <= from && from <= ranges.back().second)
+            ranges.back().second = std::max(ranges.back().second, from + bytes);
+        else
+            ranges.push_back({from, from + bytes});
+    };
+    auto addSlice = [&](auto span, size_t from, size_t to) {
+        add(span.first + from, (to - from) * sizeof(span[0]));
+    };
+    auto perRoom = [&](auto span) {
+        for (uint32_t i = first; i < last; ++i) addSlice(span, byRegion[i], byRegion[i] + 1);
+    };
+    auto starts = [&](Span<uint32_t> start) {
+        for (uint32_t i = first; i < last; ++i) addSlice(start, byRegion[i], byRegion[i] + 2);
+    };
+    auto pooled = [&](auto pool, Span<uint32_t> start) {
+        for (uint32_t i = first; i < last; ++i) addSlice(pool, start[byRegion[i]], start[byRegion[i] + 1]);
+    };
+    perRoom(w.roomKey);
+    perRoom(w.roomName);
+    perRoom(w.roomDescription);
+    perRoom(w.roomLabel);
+    perRoom(w.roomRegion);
+    starts(w.exitStart);
+    starts(w.itemStart);
+    starts(w.poiStart);
+    starts(w.actionStart);
+    pooled(w.exitDirection, w.exitStart);
+    pooled(w.exitTarget, w.exitStart);
+    pooled(w.itemPool, w.itemStart);
+    pooled(w.poiName, w.poiStart);
+    pooled(w.poiText, w.poiStart);
+    pooled(w.actionName, w.actionStart);
+    pooled(w.actionResult, w.actionStart);
+
+    // Prose, a block at a time
+    const TextStore& texts = w.texts;
+    std::vector<uint32_t> blocks;
+    auto addText = [&](TextRef t) {
+        if (t.id != 0 && t.id < texts.count) blocks.push_back(t.id / kTextsPerBlock);
+    };
+    for (uint32_t i = first; i < last; ++i) {
+        const RoomId r = byRegion[i];
+        addText(w.roomKey[r]);
+        addText(w.roomName[r]);
+        addText(w.roomDescription[r]);
+        addText(w.roomLabel[r]);
+        for (uint32_t p = w.poiStart[r]; p < w.poiStart[r + 1]; ++p) addText(w.poiText[p]);
+        for (uint32_t a = w.actionStart[r]; a < w.actionStart[r + 1]; ++a) addText(w.actionResult[a]);
+        for (uint32_t e = w.exitStart[r]; e < w.exitStart[r + 1]; ++e) {
+            const uint32_t to = w.roomRegion[w.exitTarget[e]];
+            if (to != region) g.neighbours.push_back(to);
+        }
+    }
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+    for (uint32_t b : blocks) addSlice(texts.blocks, texts.blockStart[b], texts.blockStart[b + 1]);
+    for (uint32_t b : blocks) addSlice(texts.blockStart, b, b + 2);
+    for (uint32_t b : blocks) addSlice(texts.blockLength, b, b + 1);
+
+    std::sort(ranges.begin(), ranges.end());
+    for (const auto& range : ranges) {
+        const uint32_t from = static_cast<uint32_t>(range.first / pageSize);
+        const uint32_t to = static_cast<uint32_t>((range.second - 1) / pageSize) + 1;
+        Run* run = g.runs.empty() ? nullptr : &g.runs.back();
+        if (run && from <= run->page + run->count)
+            run->count = std::max(run->count, to - run->page);
+        else
+            g.runs.push_back({from, to - from});
+    }
+    size_t pages = 0;
+    for (const Run& run : g.runs) pages += run.count;
+    counts.largestRegionBytes = std::max(counts.largestRegionBytes, pages * pageSize);
+    std::sort(g.neighbours.begin(), g.neighbours.end());
+    g.neighbours.erase(std::unique(g.neighbours.begin(), g.neighbours.end()), g.neighbours.end());
+}
+
+void RegionPager::enter(uint32_t region) {
+    if (region >= regions.size()) return;
+    bool arrived = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Region& r = regions[region];
+        ++r.sessions;
+        r.lastUse = ++clock;
+        plan(region);
+        if (!r.resident) {
+            load(region);
+            ++counts.loads;
+            arrived = true;
+        }
+        for (uint32_t neighbour : r.neighbours) {
+            Region& n = regions[neighbour];
+            n.lastUse = clock; // next in line to be needed
+            if (n.resident) continue;
+            plan(neighbour);
+            load(neighbour);
+            ++counts.prefetches;
+            queued.push_back(neighbour);
+        }
+        evictIdle();
+    }
+    wake.notify_one();
+    // The session's own region can't be evicted while it is there
+    if (arrived) touch(region);
+}
+
+void RegionPager::leave(uint32_t region) {
+    if (region >= regions.size()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Region& r = regions[region];
+        --r.sessions;
+        r.lastUse = ++clock;
+        evictIdle();
+    }
+    wake.notify_one();
+}
+
+PagingStats RegionPager::stats() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (base) settle(lock);
+    return counts;
+}
+
+// Counts the region's pages as in use. Called with the lock held; reading
+// them in is up to the caller.
+void RegionPager::load(uint32_t region) {
+    regions[region].resident = true;
+    resident.push_back(region);
+    for (const Run& run : regions[region].runs) {
+        for (uint32_t p = run.page; p < run.page + run.count; ++p) pagesInUse += pageUsers[p]++ == 0;
+    }
+    counts.resident = resident.size();
+    counts.peakResident = std::max(counts.peakResident, counts.resident);
+    changed = true;
+}
+
+// Lets go of the pages no other resident region uses. Called with the lock held.
+void RegionPager::evict(uint32_t region) {
+    regions[region].resident = false;
+    resident.erase(std::find(resident.begin(), resident.end(), region));
+    for (const Run& run : regions[region].runs) {
+        // Drops the unused pages of the run a stretch at a time
+        uint32_t from = run.page;
+        const uint32_t end = run.page + run.count;
+        for (uint32_t p = from; p <= end; ++p) {
+            if (p < end && --pageUsers[p] == 0) {
+                --pagesInUse;
+                continue;
+            }
+            if (p > from) dropPages(base + size_t{from} * pageSize, size_t{p - from} * pageSize);
+            from = p + 1;
+        }
+    }
+    ++counts.evictions;
+    counts.resident = resident.size();
+    changed = true;
+}
+
+// Evicts idle regions, those left longest ago first, until at most idleLimit
+// are left. Called with the lock held.
+void RegionPager::evictIdle() {
+    while (true) {
+        size_t idle = 0;
+        uint32_t oldest = UINT32_MAX;
+        for (uint32_t g : resident) {
+            if (regions[g].sessions != 0) continue;
+            ++idle;
+            if (oldest == UINT32_MAX || regions[g].lastUse < regions[oldest].lastUse) oldest = g;
+        }
+        if (idle <= idleLimit) return;
+        evict(oldest);
+    }
+}
+
+// Reads a byte of every page so the system maps them all in now. A planned
+// region's runs never change, so this needs no lock.
+void RegionPager::touch(uint32_t region) const {
+    unsigned char sum = 0;
+    for (const Run& run : regions[region].runs) {
+        for (uint32_t p = run.page; p < run.page + run.count; ++p)
+            sum += static_cast<unsigned char>(base[size_t{p} * pageSize]);
+    }
+    volatile unsigned char sink = sum;
+    (void)sink;
+}
+
+// Bytes of the image this process has in memory now. Pages the system
+// merely caches for the file don't count, only those mapped in for us.
+size_t RegionPager::measure() const {
+    if (!base) return 0;
+    size_t in = 0;
+#if defined(__linux__)
+    // Each mapping lists the memory it holds under Rss; the image may have
+    // been split into several, so every one inside it counts
+    std::FILE* smaps = std::fopen("/proc/self/smaps", "r");
+    if (!smaps) return 0;
+    const uintptr_t from = reinterpret_cast<uintptr_t>(base);
+    const uintptr_t to = from + imageSize;
+    bool inImage = false;
+    char line[512];
+    while (std::fgets(line, sizeof line, smaps)) {
+        unsigned long long start, end, kb;
+        if (std::sscanf(line, "%llx-%llx ", &start, &end) == 2)
+            inImage = start < to && end > from;
+        else if (inImage && std::sscanf(line, "Rss: %llu kB", &kb) == 1)
+            in += static_cast<size_t>(kb) * 1024 / pageSize;
+    }
+    std::fclose(smaps);
+#elif defined(_WIN32)
+    const size_t pages = (imageSize + pageSize - 1) / pageSize;
+    std::vector<PSAPI_WORKING_SET_EX_INFORMATION> info(pages);
+    for (size_t p = 0; p < pages; ++p) info[p].VirtualAddress = const_cast<char*>(base + p * pageSize);
+    if (!QueryWorkingSetEx(GetCurrentProcess(), info.data(), static_cast<DWORD>(pages * sizeof(info[0]))))
+        return 0;
+    for (const PSAPI_WORKING_SET_EX_INFORMATION& page : info) in += page.VirtualAttributes.Valid;
+#else
+    // Elsewhere only the file's cached pages can be seen, which overcounts
+    // what a fresh image still has cached from being written
+    const size_t pages = (imageSize + pageSize - 1) / pageSize;
+#ifdef __APPLE__
+    std::vector<char> pageIn(pages);
+#else
+    std::vector<unsigned char> pageIn(pages);
+#endif
+    if (::mincore(const_cast<char*>(base), imageSize, pageIn.data()) != 0) return 0;
+    for (auto page : pageIn) in += page & 1;
+#endif
+    return in * pageSize;
+}
+
+// Measures what is in memory, without the lock, and sweeps if more than
+// kStrayBytes of it lies outside the regions in memory
+void RegionPager::settle(std::unique_lock<std::mutex>& lock) {
+    lock.unlock();
+    size_t bytes = measure();
+    lock.lock();
+    if (bytes > pagesInUse * pageSize + kStrayBytes) {
+        sweep();
+        ++counts.sweeps;
+        lock.unlock();
+        bytes = measure();
+        lock.lock();
+    }
+    counts.residentBytes = bytes;
+    counts.peakResidentBytes = std::max(counts.peakResidentBytes, bytes);
+}
+
+// Hands back every page no resident region uses. Called with the lock held,
+// so no region arrives meanwhile and loses its pages.
+void RegionPager::sweep() {
+    const uint32_t pages = static_cast<uint32_t>(pageUsers.size());
+    uint32_t from = 0;
+    for (uint32_t p = 0; p <= pages; ++p) {
+        if (p < pages && pageUsers[p] == 0) continue;
+        const size_t at = size_t{from} * pageSize;
+        if (p > from) dropPages(base + at, std::min(size_t{p - from} * pageSize, imageSize - at));
+        from = p + 1;
+    }
+}
+
+// The background thread. First it hands back whatever reading the world at
+// startup brought in. Then it reads in queued regions that are still wanted,
+// and settles what is in memory once nothing is queued. A region evicted
+// while it is being read keeps what was read until the system wants the
+// memory back.
+void RegionPager::prefetch() {
+    std::unique_lock<std::mutex> lock(mutex);
+    sweep();
+    changed = true;
+    while (true) {
+        wake.wait(lock, [this] { return stopping || !queued.empty() || changed; });
+        if (stopping) return;
+        if (!queued.empty()) {
+            const uint32_t region = queued.front();
+            queued.pop_front();
+            if (!regions[region].resident) continue;
+            lock.unlock();
+            touch(region);
+            lock.lock();
+            continue;
+        }
+        changed = false;
+        settle(lock);
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "world.h"
+
+// Regions kept in memory with nobody in them, unless the pager is told otherwise
+constexpr size_t kIdleRegions = 16;
+
+// Bytes of the image in memory outside every region before they are handed
+// back: tables of the whole world, and pages read in passing, such as those
+// of the rooms a travelled route goes through
+constexpr size_t kStrayBytes = size_t{4} << 20;
+
+// How paging has gone so far
+struct PagingStats {
+    size_t loads = 0;      // regions read in as a session arrived
+    size_t prefetches = 0; // read in ahead of a session, next to its region
+    size_t evictions = 0;
+    size_t resident = 0;   // regions in memory now
+    size_t peakResident = 0;
+    size_t largestRegionBytes = 0; // pages of the largest region planned so far
+    size_t sweeps = 0; // times pages outside every region were handed back
+    // Of the image in this process's memory, as the system reports it rather
+    // than as the pager expects: pages the system read ahead count, and so do
+    // pages outside any region, such as the name tables
+    size_t residentBytes = 0;
+    size_t peakResidentBytes = 0; // the most seen when measured, after any sweep
+};
+
+// Keeps the parts of a mapped world image that sessions are using in memory
+// and lets the rest go. Images lay rooms out region by region (see
+// WorldBuilder::buildImage), so a region's rooms, exits, items, points of
+// interest, actions and prose sit in a few runs of pages.
+//
+// A session arriving in a region reads its pages in, and a background thread
+// reads in the regions its exits lead to. Regions nobody is in stay until
+// more than `idle` of them are, and then the one left longest ago has its
+// pages handed back to the system, which reads them from the file again if
+// they are needed. Pages that a region still in memory shares are kept.
+// What a playthrough changed lives in its WorldState, which never depends on
+// the image staying in memory.
+//
+// Which pages a region uses is worked out the first time a session comes
+// near it, so starting costs no more than sorting rooms by region. The
+// background thread also hands back whatever reading the world at startup
+// brought in, and measures what is in memory after each change; once more
+// than kStrayBytes of it lies outside every region in memory, it hands
+// those pages back too.
+//
+// Worlds built in memory rather than mapped from an image have nothing to
+// page, and the pager leaves them alone. Safe to call from any thread.
+struct RegionPager {
+    RegionPager() = default;
+    ~RegionPager();
+    RegionPager(const RegionPager&) = delete;
+    RegionPager& operator=(const RegionPager&) = delete;
+
+    // Starts paging world, which must outlive the pager. Call it once
+    // whatever reads through the whole world at startup has finished.
+    void start(const World& world, size_t idle = kIdleRegions);
+
+    // A session moves into region, or out of it
+    void enter(uint32_t region);
+    void leave(uint32_t region);
+
+    // Measures what is in memory now, handing back pages outside the regions
+    // first if too many have piled up
+    PagingStats stats();
+
+private:
+    struct Run {
+        uint32_t page;
+        uint32_t count;
+    };
+    struct Region {
+        uint32_t sessions = 0;
+        bool resident = false;
+        bool planned = false; // runs and neighbours worked out
+        uint64_t lastUse = 0;
+        std::vector<Run> runs;           // its pages, ascending; fixed once planned
+        std::vector<uint32_t> neighbours; // regions its exits lead to
+    };
+
+    void plan(uint32_t region);
+    void load(uint32_t region);
+    void evict(uint32_t region);
+    void evictIdle();
+    void touch(uint32_t region) const;
+    size_t measure() const;
+    void settle(std::unique_lock<std::mutex>& lock);
+    void sweep();
+    void prefetch();
+
+    const World* world = nullptr;
+    const char* base = nullptr;
+    size_t imageSize = 0;
+    size_t pageSize = 0;
+    size_t idleLimit = 0;
+    // Region g's rooms are byRegion[roomStart[g], roomStart[g + 1])
+    std::vector<uint32_t> roomStart;
+    std::vector<RoomId> byRegion;
+
+    mutable std::mutex mutex;
+    std::vector<Region> regions;
+    std::vector<uint32_t> pageUsers; // resident regions using each page
+    size_t pagesInUse = 0;           // pages with a user
+    std::vector<uint32_t> resident;  // regions in memory, in no order
+    uint64_t clock = 0;
+    PagingStats counts;
+
+    std::condition_variable wake;
+    std::deque<uint32_t> queued; // regions to read in the background
+    bool changed = false; // something was loaded or evicted since the last measure
+    bool stopping = false;
+    std::thread thread;
+};
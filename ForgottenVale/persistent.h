@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility> // std::exchange
+
+// An array of T whose copies share everything neither has changed since, so
+// copying one is a pointer copy however big it is. Elements live in leaves of
+// 2^kLeafBits under a tree of nodes with 32 children each; changing an element
+// copies the leaf and the nodes above it only where another array still shares
+// them, and changes the rest in place. Leaves nothing was ever written to are
+// never made and read as T{}, so an array costs memory for what was set in it.
+//
+// Nodes are counted by reference and may be shared by arrays on different
+// threads; an array itself is used by one thread at a time. Freed nodes go on
+// a list for the thread that freed them and are reused, elements and all, so
+// once a thread has made as many as it ever holds, changes stop allocating.
+// T must be copy-assignable, and assigning one T to another should reuse what
+// the target already holds, as std::vector does.
+template <typename T, unsigned kLeafBits>
+struct PersistentArray {
+    PersistentArray() = default;
+    explicit PersistentArray(size_t size) : count(size) {
+        for (size_t reach = kLeafSize; reach < size; reach *= kBranches) ++levels;
+    }
+    PersistentArray(const PersistentArray& other) : root(other.root), levels(other.levels), count(other.count) {
+        if (root) root->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    PersistentArray(PersistentArray&& other) noexcept : root(other.root), levels(other.levels), count(other.count) {
+        other.root = nullptr;
+    }
+    PersistentArray& operator=(const PersistentArray& other) {
+        if (other.root) other.root->refs.fetch_add(1, std::memory_order_relaxed);
+        release(root, levels);
+        root = other.root;
+        levels = other.levels;
+        count = other.count;
+        return *this;
+    }
+    PersistentArray& operator=(PersistentArray&& other) noexcept {
+        if (this != &other) {
+            release(root, levels);
+            root = other.root;
+            levels = other.levels;
+            count = other.count;
+            other.root = nullptr;
+        }
+        return *this;
+    }
+    ~PersistentArray() { release(root, levels); }
+
+    size_t size() const { return count; }
+
+    // Element i, or nullptr if nothing in its leaf was ever written
+    const T* find(size_t i) const {
+        const Node* n = root;
+        for (unsigned level = levels; n && level > 0; --level)
+            n = static_cast<const Inner*>(n)->child[branch(i, level)];
+        return n ? &static_cast<const Leaf*>(n)->value[i & (kLeafSize - 1)] : nullptr;
+    }
+    const T& operator[](size_t i) const {
+        const T* found = find(i);
+        return found ? *found : none();
+    }
+
+    // Element i, to be changed. Nodes on the way to it that are shared get
+    // copied first, so nothing that shares this array sees the change.
+    T& edit(size_t i) {
+        Node** slot = &root;
+        for (unsigned level = levels;; --level) {
+            Node* n = *slot;
+            if (!n) {
+                n = *slot = make(level, nullptr);
+            } else if (n->refs.load(std::memory_order_acquire) != 1) {
+                Node* copy = make(level, n);
+                release(n, level);
+                n = *slot = copy;
+            }
+            if (level == 0) return static_cast<Leaf*>(n)->value[i & (kLeafSize - 1)];
+            slot = &static_cast<Inner*>(n)->child[branch(i, level)];
+        }
+    }
+
+    // Calls f(i, element) for every element of every leaf written to, in order
+    template <typename F>
+    void forEach(F f) const {
+        visit(root, levels, 0, count, f);
+    }
+
+private:
+    static constexpr unsigned kBranchBits = 5;
+    static constexpr size_t kBranches = size_t{1} << kBranchBits;
+    static constexpr size_t kLeafSize = size_t{1} << kLeafBits;
+
+    struct Node {
+        std::atomic<uint32_t> refs{1};
+        Node* nextFree = nullptr;
+    };
+    struct Inner : Node {
+        Node* child[kBranches] = {};
+    };
+    struct Leaf : Node {
+        T value[kLeafSize] = {};
+    };
+
+    // Nodes this thread has freed, ready to be handed out again
+    struct FreeNodes {
+        Node* inner = nullptr;
+        Node* leaves = nullptr;
+        ~FreeNodes() {
+            for (Node* n = inner; n;) delete static_cast<Inner*>(std::exchange(n, n->nextFree));
+            for (Node* n = leaves; n;) delete static_cast<Leaf*>(std::exchange(n, n->nextFree));
+        }
+    };
+    static FreeNodes& freeNodes() {
+        static thread_local FreeNodes nodes;
+        return nodes;
+    }
+
+    static const T& none() {
+        static const T value{};
+        return value;
+    }
+
+    static size_t branch(size_t i, unsigned level) {
+        return (i >> (kLeafBits + kBranchBits * (level - 1))) & (kBranches - 1);
+    }
+
+    // A node at level holding what from holds, or nothing if from is null
+    static Node* make(unsigned level, const Node* from) {
+        FreeNodes& spare = freeNodes();
+        if (level > 0) {
+            Inner* n = spare.inner ? static_cast<Inner*>(std::exchange(spare.inner, spare.inner->nextFree)) : new Inner;
+            n->refs.store(1, std::memory_order_relaxed);
+            for (size_t c = 0; c < kBranches; ++c) {
+                n->child[c] = from ? static_cast<const Inner*>(from)->child[c] : nullptr;
+                if (n->child[c]) n->child[c]->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+            return n;
+        }
+        Leaf* n = spare.leaves ? static_cast<Leaf*>(std::exchange(spare.leaves, spare.leaves->nextFree)) : new Leaf;
+        n->refs.store(1, std::memory_order_relaxed);
+        for (size_t v = 0; v < kLeafSize; ++v) n->value[v] = from ? static_cast<const Leaf*>(from)->value[v] : none();
+        return n;
+    }
+
+    static void release(Node* n, unsigned level) {
+        if (!n || n->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        FreeNodes& spare = freeNodes();
+        if (level > 0) {
+            for (Node* c : static_cast<Inner*>(n)->child) release(c, level - 1);
+            n->nextFree = std::exchange(spare.inner, n);
+        } else {
+            n->nextFree = std::exchange(spare.leaves, n);
+        }
+    }
+
+    template <typename F>
+    static void visit(const Node* n, unsigned level, size_t first, size_t end, F& f) {
+        if (!n || first >= end) return;
+        if (level == 0) {
+            for (size_t v = 0; v < kLeafSize && first + v < end; ++v) f(first + v, static_cast<const Leaf*>(n)->value[v]);
+            return;
+        }
+        const size_t span = kLeafSize << (kBranchBits * (level - 1));
+        for (size_t c = 0; c < kBranches; ++c)
+            visit(static_cast<const Inner*>(n)->child[c], level - 1, first + c * span, end, f);
+    }
+
+    Node* root = nullptr;
+    unsigned levels = 0; // of inner nodes above the leaves
+    size_t count = 0;
+};
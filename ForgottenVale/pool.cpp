@@ -0,0 +1,114 @@
+#include "pool.h"
+
+#include <algorithm> // std::min, std::max
+
+WorkPool::WorkPool(unsigned count) : shares(new Share[std::max(count, 1u)]) {
+    for (unsigned t = 1; t < count; ++t) threads.emplace_back([this, t] { serve(t); });
+}
+
+WorkPool::~WorkPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+}
+
+void WorkPool::run(size_t count, size_t batch, const std::function<void(size_t, size_t)>& work) {
+    if (count == 0) return;
+    batch = std::max<size_t>(batch, 1);
+    const size_t batches = (count + batch - 1) / batch;
+    if (threads.empty() || batches == 1) {
+        for (size_t first = 0; first < count; first += batch) work(first, std::min(count, first + batch));
+        return;
+    }
+
+    std::lock_guard<std::mutex> myTurn(turn);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &work;
+        jobCount = count;
+        jobBatch = batch;
+        pending.store(batches);
+        const unsigned n = size();
+        for (unsigned s = 0; s < n; ++s) {
+            std::lock_guard<std::mutex> shareLock(shares[s].mutex);
+            shares[s].next = batches * s / n;
+            shares[s].end = batches * (s + 1) / n;
+        }
+        ++generation;
+    }
+    wake.notify_all();
+    this->work(0, work, count, batch);
+    // Threads that joined late may still be looking for work; they must be
+    // out before job goes out of scope
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending.load() == 0 && active == 0; });
+    job = nullptr;
+}
+
+bool WorkPool::take(unsigned self, size_t& batch) {
+    Share& share = shares[self];
+    std::lock_guard<std::mutex> lock(share.mutex);
+    if (share.next == share.end) return false;
+    batch = --share.end;
+    return true;
+}
+
+// Takes the front half of the first share found with work left, keeping one
+// batch to run now and the rest as this thread's new share
+bool WorkPool::steal(unsigned self, size_t& batch) {
+    const unsigned n = size();
+    for (unsigned i = 1; i < n; ++i) {
+        Share& victim = shares[(self + i) % n];
+        size_t first, last;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            const size_t left = victim.end - victim.next;
+            if (left == 0) continue;
+            first = victim.next;
+            last = first + (left + 1) / 2;
+            victim.next = last;
+        }
+        batch = first;
+        std::lock_guard<std::mutex> lock(shares[self].mutex);
+        shares[self].next = first + 1;
+        shares[self].end = last;
+        return true;
+    }
+    return false;
+}
+
+void WorkPool::work(unsigned self, const std::function<void(size_t, size_t)>& job, size_t count, size_t batchSize) {
+    size_t batch;
+    while (take(self, batch) || steal(self, batch)) {
+        const size_t first = batch * batchSize;
+        job(first, std::min(count, first + batchSize));
+        if (pending.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+    }
+}
+
+void WorkPool::serve(unsigned self) {
+    unsigned seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping) return;
+        seen = generation;
+        // A thread that wakes after its run has finished finds no job; the
+        // job is read here, under the lock, so it always matches the shares
+        // it will take batches from
+        const std::function<void(size_t, size_t)>* current = job;
+        if (!current) continue;
+        const size_t count = jobCount, batch = jobBatch;
+        ++active;
+        lock.unlock();
+        work(self, *current, count, batch);
+        lock.lock();
+        if (--active == 0) done.notify_all();
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads kept around for parallel loops. Each loop's batches are dealt out
+// in contiguous shares, one per thread; the owner works through its share
+// from the back, and a thread whose share runs dry steals the front half of
+// another's. The calling thread takes a share too, and run() returns once
+// every batch is done. One loop runs at a time; callers on other threads
+// wait their turn.
+struct WorkPool {
+    // threads counts the caller, so 1 runs everything inline
+    explicit WorkPool(unsigned threads);
+    ~WorkPool();
+    WorkPool(const WorkPool&) = delete;
+    WorkPool& operator=(const WorkPool&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(threads.size() + 1); }
+
+    // Calls work(first, last) on consecutive ranges covering [0, count),
+    // each at most batch long, in no particular order
+    void run(size_t count, size_t batch, const std::function<void(size_t, size_t)>& work);
+
+private:
+    struct Share {
+        std::mutex mutex;
+        size_t next = 0, end = 0; // batches still to run
+    };
+
+    void work(unsigned self, const std::function<void(size_t, size_t)>& job, size_t count, size_t batch);
+    bool take(unsigned self, size_t& batch);
+    bool steal(unsigned self, size_t& batch);
+    void serve(unsigned self);
+
+    std::unique_ptr<Share[]> shares;
+    std::vector<std::thread> threads;
+
+    std::mutex turn;  // held for a whole run
+    std::mutex mutex; // guards the fields below
+    std::condition_variable wake, done;
+    const std::function<void(size_t, size_t)>* job = nullptr;
+    size_t jobCount = 0, jobBatch = 0;
+    unsigned generation = 0;
+    unsigned active = 0; // threads inside the current run
+    bool stopping = false;
+    std::atomic<size_t> pending{0}; // batches not finished yet
+};
@@ -0,0 +1,69 @@
+#include "render.h"
+
+#include <cerrno>
+#include <charconv>      // std::to_chars
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+static const char* const CLEAR_SEQUENCE = "\033[2J\033[H";
+
+static const char* const COLOUR_SEQUENCES[] = {
+    "\033[0m",  // Reset
+    "\033[1m",  // Bold
+    "\033[36m", // Cyan
+    "\033[32m", // Green
+    "\033[33m", // Yellow
+    "\033[35m", // Magenta
+    "\033[34m"  // Blue
+};
+
+void Frame::reset() {
+    buffer.clear();
+}
+
+void Frame::clear() {
+    buffer.clear();
+    if (ansi) buffer += CLEAR_SEQUENCE;
+}
+
+Frame& Frame::operator<<(std::string_view s) {
+    buffer.append(s.data(), s.size());
+    return *this;
+}
+
+Frame& Frame::operator<<(char c) {
+    buffer.push_back(c);
+    return *this;
+}
+
+Frame& Frame::operator<<(size_t n) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), n);
+    buffer.append(digits, static_cast<size_t>(result.ptr - digits));
+    return *this;
+}
+
+Frame& Frame::operator<<(Colour colour) {
+    if (ansi) buffer += COLOUR_SEQUENCES[static_cast<size_t>(colour)];
+    return *this;
+}
+
+void writeToConsole(std::string_view text) {
+    std::fflush(stdout); // nothing buffered by stdio may overtake the frame
+    size_t done = 0;
+    while (done < text.size()) {
+#ifdef _WIN32
+        int n = _write(1, text.data() + done, static_cast<unsigned>(text.size() - done));
+#else
+        ssize_t n = ::write(1, text.data() + done, text.size() - done);
+#endif
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return;
+        done += static_cast<size_t>(n);
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Text styles a session can ask for
+enum class Colour : uint8_t {
+    Reset,
+    Bold,
+    Cyan,
+    Green,
+    Yellow,
+    Magenta,
+    Blue
+};
+
+// Everything one response puts on screen, built up in a single buffer that is
+// reused from one response to the next so a warmed-up session doesn't
+// allocate. With ansi on, colours and screen clears become escape sequences;
+// with it off they are dropped, which suits pipes, logs and bots.
+struct Frame {
+    bool ansi = true;
+
+    // Starts an empty frame, keeping the buffer's capacity
+    void reset();
+    // Wipes the screen: anything added so far would vanish at once, so it is
+    // discarded and the frame starts with a clear instead
+    void clear();
+
+    std::string_view text() const { return buffer; }
+
+    Frame& operator<<(std::string_view s);
+    Frame& operator<<(const char* s) { return *this << std::string_view(s); }
+    Frame& operator<<(const std::string& s) { return *this << std::string_view(s); }
+    Frame& operator<<(char c);
+    Frame& operator<<(size_t n);
+    Frame& operator<<(Colour colour);
+
+private:
+    std::string buffer;
+};
+
+// Sends a frame's text to standard output with one write
+void writeToConsole(std::string_view text);
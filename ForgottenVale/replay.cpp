@@ -0,0 +1,297 @@
+#include "replay.h"
+
+#include <algorithm>     // std::nth_element, std::max_element, std::sort
+#include <chrono>
+#include <cstdlib>       // std::malloc, std::free
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+// ------------ Allocation counting ------------
+// Global operator new is replaced so benchmarks can report allocations per
+// command. The counter is per thread, so sessions on different workers never
+// contend for it.
+static thread_local uint64_t allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (size == 0) size = 1;
+    while (true) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+uint64_t allocationCount() {
+    return allocations;
+}
+
+// ------------ Transcripts ------------
+
+bool readTranscript(const std::string& path, Transcript& transcript, std::string& error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    transcript.name = path;
+    transcript.lines.clear();
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty() && line.front() == '#') continue;
+        transcript.lines.push_back(line);
+    }
+    return true;
+}
+
+std::string replayTranscript(const Game& game, const Transcript& transcript, uint64_t seed) {
+    Session session(game, Rng(seed), false);
+    std::string output(session.start());
+    for (const std::string& line : transcript.lines) {
+        if (session.finished()) break;
+        output += session.handle(line);
+    }
+    return output;
+}
+
+bool matchesGolden(const std::string& output, const std::string& goldenPath, std::string& error) {
+    std::ifstream in(goldenPath, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + goldenPath;
+        return false;
+    }
+    std::ostringstream golden;
+    golden << in.rdbuf();
+    const std::string expected = golden.str();
+    if (expected == output) return true;
+
+    // Find the first line that differs
+    size_t line = 1, begin = 0;
+    while (true) {
+        size_t endA = expected.find('\n', begin);
+        size_t endB = output.find('\n', begin);
+        std::string a = expected.substr(begin, endA == std::string::npos ? std::string::npos : endA - begin);
+        std::string b = output.substr(begin, endB == std::string::npos ? std::string::npos : endB - begin);
+        if (a != b || endA != endB || endA == std::string::npos) {
+            error = goldenPath + ":" + std::to_string(line) + ": expected \"" + a +
+                    "\", got \"" + b + "\"";
+            return false;
+        }
+        begin = endA + 1;
+        ++line;
+    }
+}
+
+size_t checkTranscripts(const Game& game, const std::string& dir, uint64_t seed, bool update,
+                        std::vector<std::string>& failures) {
+    std::vector<std::filesystem::path> paths;
+    std::error_code code;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, code)) {
+        if (entry.path().extension() == ".txt") paths.push_back(entry.path());
+    }
+    if (code) {
+        failures.push_back("cannot read " + dir + ": " + code.message());
+        return 0;
+    }
+    std::sort(paths.begin(), paths.end());
+    for (const std::filesystem::path& path : paths) {
+        Transcript transcript;
+        std::string error;
+        if (!readTranscript(path.string(), transcript, error)) {
+            failures.push_back(error);
+            continue;
+        }
+        const std::string output = replayTranscript(game, transcript, seed);
+        const std::string goldenPath = std::filesystem::path(path).replace_extension(".golden").string();
+        if (update) {
+            std::ofstream golden(goldenPath, std::ios::binary | std::ios::trunc);
+            golden << output;
+            if (!golden) failures.push_back("cannot write " + goldenPath);
+        } else if (!matchesGolden(output, goldenPath, error)) {
+            failures.push_back(error);
+        }
+    }
+    return paths.size();
+}
+
+// ------------ Benchmarking ------------
+
+BenchResult benchmark(const Game& game, const std::vector<Transcript>& transcripts,
+                      uint64_t seed, unsigned repeat, bool ansi) {
+    using Clock = std::chrono::steady_clock;
+    BenchResult result;
+    std::vector<double> latencies;
+    for (const Transcript& t : transcripts) latencies.reserve(latencies.size() + t.lines.size() * repeat);
+
+    for (unsigned run = 0; run < repeat; ++run) {
+        for (const Transcript& t : transcripts) {
+            Session session(game, Rng(seed + run), ansi);
+            session.start();
+            for (const std::string& line : t.lines) {
+                if (session.finished()) break;
+                const uint64_t allocationsBefore = allocations;
+                const Clock::time_point begin = Clock::now();
+                session.handle(line);
+                const Clock::time_point end = Clock::now();
+                result.allocations += allocations - allocationsBefore;
+                const double micros = std::chrono::duration<double, std::micro>(end - begin).count();
+                latencies.push_back(micros);
+                result.seconds += micros / 1e6;
+            }
+        }
+    }
+
+    // Each transcript again in a session of its own, played over and over.
+    // The first pass grows the session's buffers, the room overlays it
+    // touches and its route cache, and until the undo history is full each
+    // checkpoint keeps its own copy of what its command changed. Once both
+    // are behind it, the next passes are counted and should allocate nothing.
+    Arena words;
+    const int kCountedPasses = 3;
+    for (const Transcript& t : transcripts) {
+        Session warm(game, Rng(seed), ansi);
+        warm.start();
+        size_t played = 0;
+        for (int pass = 0, counted = 0; counted < kCountedPasses; ++pass) {
+            const bool counting = pass > 0 && played >= Session::kCheckpoints;
+            const size_t playedBefore = played;
+            for (const std::string& line : t.lines) {
+                const Span<std::string_view> w = splitCommand(line, words);
+                const bool quits = !w.empty() && game.commands.lookup(w[0], Room{}).has(Verb::Exit);
+                words.reset();
+                if (quits) continue;
+                const uint64_t allocationsBefore = allocations;
+                warm.handle(line);
+                ++played;
+                if (!counting) continue;
+                result.warmAllocations += allocations - allocationsBefore;
+                ++result.warmCommands;
+            }
+            if (played == playedBefore) break; // nothing but quitting
+            if (counting) ++counted;
+        }
+    }
+
+    result.commands = latencies.size();
+    if (!latencies.empty()) {
+        auto percentile = [&](double p) {
+            auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(p * (latencies.size() - 1));
+            std::nth_element(latencies.begin(), nth, latencies.end());
+            return *nth;
+        };
+        result.p50Micros = percentile(0.50);
+        result.p99Micros = percentile(0.99);
+    }
+    return result;
+}
+
+SoakResult soak(const Game& game, size_t commands, uint64_t seed) {
+    using Clock = std::chrono::steady_clock;
+    const World& world = game.world;
+    SoakResult result;
+    Rng rng(seed);
+    std::vector<double> latencies;
+    latencies.reserve(commands);
+    std::vector<bool> visited(world.roomCount(), false);
+    std::vector<Symbol> carried; // what was taken, whether or not it worked
+    std::string line;
+
+    const Clock::time_point started = Clock::now();
+    Session session(game, Rng(seed), false);
+    session.start();
+    result.startMillis = std::chrono::duration<double, std::milli>(Clock::now() - started).count();
+
+    // Sets line to a command made from what the player's room offers
+    auto pick = [&]() {
+        const RoomId room = session.room();
+        const Span<ItemStack> items = slice(world.itemPool, world.itemStart, room);
+        const Span<Symbol> pois = slice(world.poiName, world.poiStart, room);
+        const Span<Symbol> actions = slice(world.actionName, world.actionStart, room);
+        auto any = [&rng](Span<Symbol> from) { return symbolText(from[rng.below(static_cast<uint32_t>(from.size()))]); };
+
+        const uint32_t roll = rng.below(100);
+        if (roll < 55 && world.exitStart[room] != world.exitStart[room + 1]) {
+            line.assign("go ").append(any(slice(world.exitDirection, world.exitStart, room)));
+        } else if (roll < 65 && !items.empty()) {
+            carried.push_back(items[rng.below(static_cast<uint32_t>(items.size()))].item);
+            line.assign("take ").append(symbolText(carried.back()));
+        } else if (roll < 70 && !carried.empty()) {
+            const size_t i = rng.below(static_cast<uint32_t>(carried.size()));
+            line.assign("drop ").append(symbolText(carried[i]));
+            carried[i] = carried.back();
+            carried.pop_back();
+        } else if (roll < 74 && carried.size() >= 2) {
+            line.assign("combine ").append(symbolText(carried[rng.below(static_cast<uint32_t>(carried.size()))]));
+            line.append(" and ").append(symbolText(carried[rng.below(static_cast<uint32_t>(carried.size()))]));
+        } else if (roll < 84 && !actions.empty()) {
+            line.assign("use ").append(any(actions));
+        } else if (roll < 92 && !pois.empty()) {
+            line.assign("examine ").append(any(pois));
+        } else if (roll < 95) {
+            line.assign("inventory");
+        } else if (roll < 96) {
+            const RoomId to = rng.below(static_cast<uint32_t>(world.roomCount()));
+            line.assign("travel ").append(world.str(world.roomKey[to]));
+        } else if (roll < 97) {
+            line.assign(rng.below(2) ? "undo" : "rewind 5");
+        } else {
+            line.assign("look");
+        }
+    };
+
+    for (size_t n = 0; n < commands && !session.finished(); ++n) {
+        if (!visited[session.room()]) {
+            visited[session.room()] = true;
+            ++result.roomsVisited;
+        }
+        pick();
+        const uint64_t allocationsBefore = allocations;
+        const Clock::time_point begin = Clock::now();
+        session.handle(line);
+        const Clock::time_point end = Clock::now();
+        result.allocations += allocations - allocationsBefore;
+        const double micros = std::chrono::duration<double, std::micro>(end - begin).count();
+        latencies.push_back(micros);
+        result.seconds += micros / 1e6;
+    }
+
+    result.commands = latencies.size();
+    if (!latencies.empty()) {
+        result.maxMicros = *std::max_element(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(p * (latencies.size() - 1));
+            std::nth_element(latencies.begin(), nth, latencies.end());
+            return *nth;
+        };
+        result.p50Micros = percentile(0.50);
+        result.p99Micros = percentile(0.99);
+    }
+
+    // A fork should cost the same whatever the size of the world, and then
+    // answer every command exactly as the session it came from
+    if (!session.finished()) {
+        const uint64_t allocationsBefore = allocations;
+        const Clock::time_point begin = Clock::now();
+        std::unique_ptr<Session> copy = session.fork();
+        result.forkMicros = std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+        result.forkAllocations = allocations - allocationsBefore;
+        std::string expected;
+        for (size_t n = 0; n < kForkCommands && !session.finished(); ++n) {
+            pick();
+            expected.assign(session.handle(line));
+            if (copy->handle(line) != expected) break;
+            ++result.forkCommands;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "session.h"
+
+// A recorded game: the lines a player typed, in order. In transcript files
+// every line is one line of input, except lines starting with '#', which are
+// comments.
+struct Transcript {
+    std::string name;
+    std::vector<std::string> lines;
+};
+
+bool readTranscript(const std::string& path, Transcript& transcript, std::string& error);
+
+// Plays a transcript through a fresh plain-text session and returns
+// everything it showed. The same seed always gives the same output.
+std::string replayTranscript(const Game& game, const Transcript& transcript, uint64_t seed);
+
+// Compares output with a golden file line by line. On a mismatch, error names
+// the first line that differs.
+bool matchesGolden(const std::string& output, const std::string& goldenPath, std::string& error);
+
+// Replays every transcript in dir (its .txt files, in name order) with seed
+// and compares each with the .golden file of the same name beside it, or
+// with update set, writes those files instead. Returns how many transcripts
+// there were; failures gets one line for each that differs.
+size_t checkTranscripts(const Game& game, const std::string& dir, uint64_t seed, bool update,
+                        std::vector<std::string>& failures);
+
+struct BenchResult {
+    size_t commands = 0;
+    double seconds = 0;    // spent inside Session::handle
+    double p50Micros = 0;  // per-command latency
+    double p99Micros = 0;
+    uint64_t allocations = 0;
+    // The same, for sessions that have already played their transcript
+    // once and filled their undo history: what handling a command costs once buffers and caches have
+    // grown to fit, which should be nothing
+    size_t warmCommands = 0;
+    uint64_t warmAllocations = 0;
+};
+
+// Replays every transcript `repeat` times, timing each command on its own.
+// Then each one is played over and over in a session of its own, skipping
+// lines that would quit, to count what warmed-up sessions allocate.
+BenchResult benchmark(const Game& game, const std::vector<Transcript>& transcripts,
+                      uint64_t seed, unsigned repeat, bool ansi);
+
+struct SoakResult {
+    size_t commands = 0;
+    size_t roomsVisited = 0;
+    double startMillis = 0; // creating the session and showing the first room
+    double seconds = 0;     // spent inside Session::handle
+    double p50Micros = 0;   // per-command latency
+    double p99Micros = 0;
+    double maxMicros = 0;
+    uint64_t allocations = 0;
+    double forkMicros = 0; // forking the session once the commands are done
+    uint64_t forkAllocations = 0;
+    size_t forkCommands = 0; // of kForkCommands, answered alike by both sides
+};
+
+// Commands a soak plays through a fork and its original side by side
+const size_t kForkCommands = 200;
+
+// Plays `commands` random commands through one session, each made from what
+// the player's room offers: mostly leaving by one of its exits, otherwise
+// taking, dropping and crafting things, examining things, doing the room's
+// actions, now and then travelling to a room picked from the whole world
+// and now and then taking a few commands back. Never talks to anyone, since
+// a conversation waits for a choice. Then forks the session and plays the
+// fork and the original on with the same commands, stopping at the first
+// answer that differs.
+SoakResult soak(const Game& game, size_t commands, uint64_t seed);
+
+// Heap allocations made by the calling thread so far
+uint64_t allocationCount();
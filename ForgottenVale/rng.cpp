@@ -0,0 +1,72 @@
+#include "rng.h"
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// splitmix64 spreads any seed, even 0, over all four state words
+Rng::Rng(uint64_t seed) {
+    for (uint64_t& word : s) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        word = z ^ (z >> 31);
+    }
+}
+
+uint64_t Rng::next() {
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+}
+
+// Lemire's multiply-shift: no division on the common path and no modulo bias
+uint32_t Rng::below(uint32_t bound) {
+    uint64_t m = (next() >> 32) * bound;
+    if (static_cast<uint32_t>(m) < bound) {
+        const uint32_t threshold = (0u - bound) % bound;
+        while (static_cast<uint32_t>(m) < threshold) m = (next() >> 32) * bound;
+    }
+    return static_cast<uint32_t>(m >> 32);
+}
+
+static void jumpBy(Rng& rng, const uint64_t (&polynomial)[4]) {
+    uint64_t t[4] = {0, 0, 0, 0};
+    for (uint64_t word : polynomial) {
+        for (int b = 0; b < 64; ++b) {
+            if (word & (uint64_t{1} << b)) {
+                for (int i = 0; i < 4; ++i) t[i] ^= rng.s[i];
+            }
+            rng.next();
+        }
+    }
+    for (int i = 0; i < 4; ++i) rng.s[i] = t[i];
+}
+
+void Rng::jump() {
+    static const uint64_t polynomial[4] = {
+        0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+        0xa9582618e03fc9aaull, 0x39abdc4529b1661cull
+    };
+    jumpBy(*this, polynomial);
+}
+
+void Rng::longJump() {
+    static const uint64_t polynomial[4] = {
+        0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull,
+        0x77710069854ee241ull, 0x39109bb02acbe635ull
+    };
+    jumpBy(*this, polynomial);
+}
+
+Rng Rng::split() {
+    Rng child = *this;
+    jump();
+    return child;
+}
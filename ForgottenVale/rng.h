@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// xoshiro256** (Blackman & Vigna): a small, fast generator with 256 bits of
+// state. Each session owns one, so nothing random is shared between players
+// and a game replays exactly from its seed.
+//
+// jump() advances the stream by 2^128 draws and longJump() by 2^192, which
+// splits one seed into streams that will never overlap in practice: give each
+// worker thread its own long jump, and each session a split() of its worker.
+struct Rng {
+    uint64_t s[4];
+
+    explicit Rng(uint64_t seed = 0);
+
+    uint64_t next();
+    // Uniform in [0, bound); bound must not be zero
+    uint32_t below(uint32_t bound);
+
+    void jump();
+    void longJump();
+    // Returns a generator for the current stream and moves this one 2^128
+    // draws ahead, so the two never meet
+    Rng split();
+};
@@ -1,3 +1,94 @@
 #include "room.h"
 
-// No room-specific method implementations yet
+Symbol NPC::name() const {
+    return world->npcName[id];
+}
+
+uint32_t NPC::startNode() const {
+    return world->npcStartNode[id];
+}
+
+std::string_view Room::name() const {
+    return world->str(world->roomName[id]);
+}
+
+std::string_view Room::description() const {
+    return world->str(world->roomDescription[id]);
+}
+
+std::string_view Room::label() const {
+    return world->str(world->roomLabel[id]);
+}
+
+Span<Symbol> Room::exits() const {
+    return slice(world->exitDirection, world->exitStart, id);
+}
+
+uint32_t Room::findExit(Symbol direction) const {
+    for (uint32_t e = world->exitStart[id]; e < world->exitStart[id + 1]; ++e) {
+        if (world->exitDirection[e] == direction) return e;
+    }
+    return kNoExit;
+}
+
+Room Room::exitTarget(uint32_t exit) const {
+    return {world, state, world->exitTarget[exit]};
+}
+
+bool Room::exitLocked(uint32_t exit) const {
+    if (!state) return (world->exitLockBits[exit >> 6] >> (exit & 63)) & 1u;
+    return state->exitLocked(exit);
+}
+
+ItemList Room::items() const {
+    if (state) {
+        const RoomChange* changed = state->rooms.find(id);
+        if (changed && changed->hasItems) return changed->items;
+    }
+    return slice(world->itemPool, world->itemStart, id);
+}
+
+// First change to a room copies its starting items out of the shared world.
+// Callers are about to change them, so the room's version moves on here.
+static ItemSet& editableItems(const World* world, WorldState* state, RoomId id) {
+    RoomChange& changed = state->rooms.edit(id);
+    ++changed.version;
+    if (!changed.hasItems) {
+        changed.items.clear(); // a recycled node may still hold another room's
+        for (const ItemStack& stack : slice(world->itemPool, world->itemStart, id))
+            changed.items.add(stack.item, stack.count);
+        changed.hasItems = true;
+    }
+    return changed.items;
+}
+
+bool Room::takeItem(Symbol item) {
+    if (!items().contains(item)) return false;
+    return editableItems(world, state, id).remove(item) != 0;
+}
+
+void Room::addItem(Symbol item) {
+    editableItems(world, state, id).add(item);
+}
+
+Span<Symbol> Room::pointsOfInterest() const {
+    return slice(world->poiName, world->poiStart, id);
+}
+
+std::string_view Room::pointOfInterest(Symbol name) const {
+    for (uint32_t p = world->poiStart[id]; p < world->poiStart[id + 1]; ++p) {
+        if (world->poiName[p] == name) return world->str(world->poiText[p]);
+    }
+    return {};
+}
+
+Span<Symbol> Room::actions() const {
+    return slice(world->actionName, world->actionStart, id);
+}
+
+std::string_view Room::actionResult(Symbol action) const {
+    for (uint32_t a = world->actionStart[id]; a < world->actionStart[id + 1]; ++a) {
+        if (world->actionName[a] == action) return world->str(world->actionResult[a]);
+    }
+    return {};
+}
@@ -1,31 +1,56 @@
 #pragma once
 
-#include <string>
-#include <unordered_map>
-#include <vector>
+#include <string_view>
 
-struct NPC;
+#include "world.h"
 
-struct Room {
-    std::string name;
-    std::string description;
-    std::unordered_map<std::string, Room*> exits;
-    std::unordered_map<std::string, bool> exitLocked;
-    std::vector<std::string> items;
-    std::vector<std::string> actions;
-    std::unordered_map<std::string, std::string> actionResults;
-    std::unordered_map<std::string, std::string> pointsOfInterest;
-    NPC* npc = nullptr;
-};
+// Handle to one character of a World
+struct NPC {
+    const World* world = nullptr;
+    uint32_t id = kNoNpc;
 
-struct DialogueOption {
-    std::string prompt;
-    std::string response;
-};
+    explicit operator bool() const { return id != kNoNpc; }
 
-struct NPC {
-    std::string name;
-    std::string greeting;
-    std::vector<DialogueOption> options;
+    Symbol name() const;
+    // Dialogue node conversations with them start from
+    uint32_t startNode() const;
 };
 
+// Lightweight handle to one room of a World as one playthrough sees it. It is
+// just two pointers and an index, so it is passed by value; everything it
+// returns is read straight out of the world's arrays or the state's overlay.
+// Handles without a state see the world as it starts and can't change it.
+struct Room {
+    const World* world = nullptr;
+    WorldState* state = nullptr;
+    RoomId id = kNoRoom;
+
+    std::string_view name() const;
+    std::string_view description() const;
+    std::string_view label() const;
+
+    // Exit directions in the order they were defined
+    Span<Symbol> exits() const;
+    // World-wide index of the exit in that direction, or kNoExit
+    uint32_t findExit(Symbol direction) const;
+    Room exitTarget(uint32_t exit) const;
+    bool exitLocked(uint32_t exit) const;
+
+    // The room's own set once this playthrough has changed its items,
+    // otherwise its starting stacks straight out of the world image
+    ItemList items() const;
+    // Takes one of item out of the room, or returns false if there is none
+    bool takeItem(Symbol item);
+    void addItem(Symbol item);
+
+    Span<Symbol> pointsOfInterest() const;
+    // Description of a point of interest, empty if the room has none by that name
+    std::string_view pointOfInterest(Symbol name) const;
+
+    Span<Symbol> actions() const;
+    // Text printed when the action is performed, empty if it has none
+    std::string_view actionResult(Symbol action) const;
+
+    bool operator==(const Room& other) const { return world == other.world && state == other.state && id == other.id; }
+    bool operator!=(const Room& other) const { return !(*this == other); }
+};
@@ -0,0 +1,125 @@
+#include "routes.h"
+
+#include <algorithm> // std::binary_search
+#include <cctype>    // std::tolower
+
+static const uint32_t kFar = UINT32_MAX; // distance from rooms with no way through
+
+static char lower(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+void RouteIndex::build(const World& world) {
+    const size_t rooms = world.roomCount();
+    inStart.assign(rooms + 1, 0);
+    for (RoomId to : world.exitTarget) ++inStart[to + 1];
+    for (size_t r = 0; r < rooms; ++r) inStart[r + 1] += inStart[r];
+    inExit.assign(world.exitTarget.size(), 0);
+    inFrom.assign(world.exitTarget.size(), 0);
+    std::vector<uint32_t> fill(inStart.begin(), inStart.end() - 1);
+    for (RoomId r = 0; r < rooms; ++r) {
+        for (uint32_t e = world.exitStart[r]; e < world.exitStart[r + 1]; ++e) {
+            const uint32_t i = fill[world.exitTarget[e]]++;
+            inExit[i] = e;
+            inFrom[i] = r;
+        }
+    }
+}
+
+RoomId RouteIndex::findRoom(const World& world, std::string_view text) const {
+    const Span<RoomNameSlot> table = world.roomNameTable;
+    if (table.empty()) return kNoRoom;
+    const uint64_t hash = roomNameHash(text);
+    const size_t mask = table.size() - 1;
+    for (size_t i = hash & mask; table[i].room != kNoRoom; i = (i + 1) & mask) {
+        const RoomNameSlot& slot = table[i];
+        if (slot.hash != hash) continue;
+        const TextRef ref = slot.kind == RoomNameKey     ? world.roomKey[slot.room]
+                            : slot.kind == RoomNameLabel ? world.roomLabel[slot.room]
+                                                         : world.roomName[slot.room];
+        const std::string_view name = world.str(ref);
+        if (name.size() != text.size()) continue;
+        size_t same = 0;
+        while (same < name.size() && lower(name[same]) == text[same]) ++same;
+        if (same == name.size()) return slot.room;
+    }
+    return kNoRoom;
+}
+
+// Whether a session with state's locks can follow tree
+bool RouteCache::fits(const RouteTree& tree, const World& world, const WorldState& state) {
+    auto stale = [&](uint32_t exit) {
+        const bool locked = state.exitLocked(exit);
+        const bool startLocked = (world.exitLockBits[exit >> 6] >> (exit & 63)) & 1u;
+        if (locked == (startLocked != std::binary_search(tree.toggled.begin(), tree.toggled.end(), exit)))
+            return false;
+        const RoomId from = world.exitRoom(exit);
+        const RoomId to = world.exitTarget[exit];
+        return locked ? tree.next[from] == exit
+                      : tree.distance[to] != kFar && tree.distance[to] + 1 < tree.distance[from];
+    };
+    for (uint32_t exit : tree.toggled) {
+        if (stale(exit)) return false;
+    }
+    bool fit = true;
+    state.toggledLocks.forEach([&](size_t word, uint64_t bits) {
+        for (uint32_t b = 0; fit && b < 64; ++b)
+            if ((bits >> b) & 1u) fit = !stale(static_cast<uint32_t>(word * 64 + b));
+    });
+    return fit;
+}
+
+// Breadth-first back from the target over the exits open in state
+void RouteCache::grow(RouteTree& tree, RoomId target, const World& world,
+                      const RouteIndex& index, const WorldState& state) {
+    const size_t rooms = world.roomCount();
+    tree.target = target;
+    tree.toggled.clear();
+    state.toggledLocks.forEach([&](size_t word, uint64_t bits) {
+        for (uint32_t b = 0; b < 64; ++b)
+            if ((bits >> b) & 1u) tree.toggled.push_back(static_cast<uint32_t>(word * 64 + b));
+    });
+    tree.next.assign(rooms, kNoExit);
+    tree.distance.assign(rooms, kFar);
+    std::vector<RoomId> queue{target};
+    tree.distance[target] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const RoomId to = queue[head];
+        for (uint32_t i = index.inStart[to]; i < index.inStart[to + 1]; ++i) {
+            const uint32_t exit = index.inExit[i];
+            const RoomId from = index.inFrom[i];
+            if (tree.distance[from] != kFar || state.exitLocked(exit)) continue;
+            tree.distance[from] = tree.distance[to] + 1;
+            tree.next[from] = exit;
+            queue.push_back(from);
+        }
+    }
+}
+
+std::shared_ptr<const RouteTree> RouteCache::toward(RoomId target, const World& world,
+                                                    const RouteIndex& index, const WorldState& state) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++clock;
+        for (Entry& e : entries) {
+            if (e.tree && e.tree->target == target && fits(*e.tree, world, state)) {
+                e.lastUse = clock;
+                return e.tree;
+            }
+        }
+    }
+
+    // Searched without the lock, so other sessions' routes don't wait on it.
+    // A tree pushed out stays alive for sessions still following it.
+    auto tree = std::make_shared<RouteTree>();
+    grow(*tree, target, world, index, state);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Entry* oldest = &entries[0];
+    for (Entry& e : entries) {
+        if (e.lastUse < oldest->lastUse) oldest = &e;
+    }
+    oldest->tree = tree;
+    oldest->lastUse = ++clock;
+    return tree;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "world.h"
+
+// What routing needs from a world beyond its exits: the exits leading into
+// each room, as CSR over RoomId, and the rooms they lead from. Built once at
+// startup and read-only afterwards, so a search across the whole world reads
+// none of a mapped image's exits. Rooms are found by name through the
+// world's own table, so starting up reads none of their names.
+struct RouteIndex {
+    void build(const World& world);
+
+    // Room whose key, label or name is text (in lower case), or kNoRoom
+    RoomId findRoom(const World& world, std::string_view text) const;
+
+    std::vector<uint32_t> inStart; // per room + 1, range into inExit
+    std::vector<uint32_t> inExit;  // exits leading into each room
+    std::vector<RoomId> inFrom;    // the room each of those leads from
+};
+
+// Shortest routes to one room under one set of locks: for every room, the
+// exit that leads one step closer to the target, found by a breadth-first
+// search back from it
+struct RouteTree {
+    RoomId target = kNoRoom;
+    std::vector<uint32_t> toggled;  // exits locked or opened since the world started, ascending
+    std::vector<uint32_t> next;     // per room; kNoExit with no way through, and at the target
+    std::vector<uint32_t> distance; // per room, UINT32_MAX if cut off
+};
+
+// Route trees shared by every session of a world. A session can follow a
+// tree built under other locks than its own unless an exit they differ on
+// could alter it: one the tree uses that the session has locked, or one the
+// session has opened that shortens a route. So a lock change only keeps a
+// session off the trees that exit touches, and sessions whose locks agree
+// where it matters share one tree. Safe to use from any thread.
+struct RouteCache {
+    std::shared_ptr<const RouteTree> toward(RoomId target, const World& world,
+                                            const RouteIndex& index, const WorldState& state);
+
+private:
+    struct Entry {
+        std::shared_ptr<RouteTree> tree;
+        uint64_t lastUse = 0; // 0 while empty
+    };
+    static const size_t kTrees = 8;
+
+    static bool fits(const RouteTree& tree, const World& world, const WorldState& state);
+    static void grow(RouteTree& tree, RoomId target, const World& world,
+                     const RouteIndex& index, const WorldState& state);
+
+    std::mutex mutex;
+    std::array<Entry, kTrees> entries; // least recently used is replaced first
+    uint64_t clock = 0;
+};
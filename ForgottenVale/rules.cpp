@@ -0,0 +1,23 @@
+#include "rules.h"
+
+#include <algorithm> // std::stable_sort
+
+static uint64_t ruleKey(RoomId room, Symbol trigger) {
+    return mix((static_cast<uint64_t>(room) << 32) | trigger);
+}
+
+void RuleIndex::build(const World& world) {
+    std::vector<std::pair<uint64_t, uint32_t>> keyed;
+    keyed.reserve(world.ruleCount());
+    for (uint32_t r = 0; r < world.ruleCount(); ++r)
+        keyed.emplace_back(ruleKey(world.ruleRoom[r], world.ruleTrigger[r]), r);
+    // Stable, so rules sharing a key keep their priority
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    table.build(keyed);
+}
+
+Span<uint32_t> RuleIndex::find(RoomId room, Symbol trigger) const {
+    if (table.empty() || trigger == kNoSymbol) return {};
+    return table.find(ruleKey(room, trigger));
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "hashing.h"
+#include "world.h"
+
+// Dispatch table for a world's rules, keyed by (room, trigger). Every pair
+// that has rules hashes to one slot holding them in the order they were
+// defined, so finding the rules for what the player just did is a single
+// probe however many rules the world has. Rules for any room are filed
+// under kNoRoom. Built once at startup and read-only afterwards.
+struct RuleIndex {
+    void build(const World& world);
+
+    // Rules for trigger in room, in definition order; empty if there are none
+    Span<uint32_t> find(RoomId room, Symbol trigger) const;
+
+private:
+    KeyedRanges<uint32_t> table; // rules by (room, trigger)
+};
@@ -0,0 +1,483 @@
+#include "save.h"
+
+#include <condition_variable>
+#include <cstring>       // std::memcpy, std::memcmp
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "worldfile.h"   // mapFile
+
+#ifdef _WIN32
+#include <io.h>          // _commit
+#else
+#include <unistd.h>      // fsync
+#endif
+
+static const char kJournalMagic[8] = {'V', 'A', 'L', 'E', 'J', 'N', 'L', '\0'};
+static const char kSnapshotMagic[8] = {'V', 'A', 'L', 'E', 'S', 'A', 'V', '\0'};
+static const uint32_t kSnapshotVersion = 4;
+
+struct JournalHeader {
+    char magic[8];
+    uint64_t world; // World::fingerprint
+};
+
+// Fixed part of a snapshot. It is followed by the inventory (uint32_t each),
+// the visited bits and the flags (uint64_t words each), each region's weather
+// and the exits whose lock state differs from the world's (uint32_t each)
+// and, for each room whose items changed, its id, item count and items
+// (uint32_t each).
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t room;
+    uint64_t world;
+    uint64_t segment; // journal segments up to this one are included
+    uint64_t random[4];
+    uint32_t flagWords;
+    uint32_t regions;
+    uint32_t dialogueNode;
+    uint32_t inventoryCount;
+    uint32_t visitedWords;
+    uint32_t toggledExits;
+    uint32_t changedRooms;
+    uint32_t tick;
+    uint32_t ambientDue;
+    uint32_t weatherDue;
+};
+
+static std::string segmentPath(const std::string& path, uint64_t segment) {
+    return path + ".journal." + std::to_string(segment);
+}
+
+static uint32_t checksum(const unsigned char* bytes, size_t size) {
+    uint32_t h = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < size; ++i) {
+        h ^= bytes[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void put(std::vector<char>& out, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+// ------------ Journal records ------------
+// Each record is: type (1 byte), payload length (1 byte), payload, and a
+// checksum of everything before it (4 bytes).
+
+static void encodeChange(const Change& change, std::vector<char>& out) {
+    unsigned char record[2 + 32];
+    record[0] = static_cast<unsigned char>(change.type);
+    if (change.type == ChangeType::Random) {
+        record[1] = 32;
+        std::memcpy(record + 2, change.random, 32);
+    } else {
+        record[1] = 8;
+        std::memcpy(record + 2, &change.a, 4);
+        std::memcpy(record + 6, &change.b, 4);
+    }
+    const size_t size = 2 + record[1];
+    const uint32_t sum = checksum(record, size);
+    put(out, record, size);
+    put(out, &sum, sizeof(sum));
+}
+
+// Reads one record at bytes[pos]; false at the end of the data or at a torn
+// or damaged record
+static bool decodeChange(const char* bytes, size_t size, size_t& pos, Change& change) {
+    if (size - pos < 2) return false;
+    const unsigned char* record = reinterpret_cast<const unsigned char*>(bytes + pos);
+    const size_t length = record[1];
+    if (size - pos < 2 + length + 4) return false;
+    uint32_t sum;
+    std::memcpy(&sum, record + 2 + length, 4);
+    if (sum != checksum(record, 2 + length)) return false;
+
+    change = Change{static_cast<ChangeType>(record[0])};
+    if (change.type == ChangeType::Random && length == 32) {
+        std::memcpy(change.random, record + 2, 32);
+    } else if (change.type >= ChangeType::Move && change.type <= ChangeType::Timer &&
+               change.type != ChangeType::Random && length == 8) {
+        std::memcpy(&change.a, record + 2, 4);
+        std::memcpy(&change.b, record + 6, 4);
+    } else {
+        return false;
+    }
+    pos += 2 + length + 4;
+    return true;
+}
+
+// ------------ Snapshots ------------
+
+// Items are stored one symbol per item, in arrival order, so adding them back
+// one at a time rebuilds the same stacks
+static std::vector<Symbol> itemList(const ItemSet& items) {
+    std::vector<Symbol> list;
+    for (const ItemStack& stack : items) list.insert(list.end(), stack.count, stack.item);
+    return list;
+}
+
+static void addItems(ItemSet& items, const std::vector<Symbol>& list) {
+    for (Symbol item : list) items.add(item);
+}
+
+static std::vector<char> encodeSnapshot(const SaveState& state, const World& world, uint64_t segment) {
+    std::vector<uint32_t> toggled;
+    state.world.toggledLocks.forEach([&](size_t word, uint64_t bits) {
+        for (uint32_t b = 0; b < 64; ++b)
+            if ((bits >> b) & 1u) toggled.push_back(static_cast<uint32_t>(word * 64 + b));
+    });
+
+    // Only rooms whose items really differ from how they started, in order
+    std::vector<RoomId> changed;
+    state.world.rooms.forEach([&](size_t room, const RoomChange& c) {
+        if (c.hasItems && ItemList(c.items) != slice(world.itemPool, world.itemStart, static_cast<RoomId>(room))) changed.push_back(static_cast<RoomId>(room));
+    });
+
+    std::vector<uint64_t> visited(state.visited.size());
+    state.visited.forEach([&](size_t word, uint64_t bits) { visited[word] = bits; });
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.room = state.room;
+    header.world = world.fingerprint;
+    header.segment = segment;
+    std::memcpy(header.random, state.rng.s, sizeof(header.random));
+    header.flagWords = static_cast<uint32_t>(state.flags.size());
+    header.regions = static_cast<uint32_t>(state.weather.size());
+    header.tick = state.tick;
+    header.ambientDue = state.ambientDue;
+    header.weatherDue = state.weatherDue;
+    header.dialogueNode = state.dialogueNode;
+    const std::vector<Symbol> inventory = itemList(state.inventory);
+    header.inventoryCount = static_cast<uint32_t>(inventory.size());
+    header.visitedWords = static_cast<uint32_t>(visited.size());
+    header.toggledExits = static_cast<uint32_t>(toggled.size());
+    header.changedRooms = static_cast<uint32_t>(changed.size());
+
+    std::vector<char> out;
+    put(out, &header, sizeof(header));
+    put(out, inventory.data(), inventory.size() * sizeof(Symbol));
+    put(out, visited.data(), visited.size() * sizeof(uint64_t));
+    put(out, state.flags.data(), state.flags.size() * sizeof(uint64_t));
+    put(out, state.weather.data(), state.weather.size() * sizeof(uint32_t));
+    put(out, toggled.data(), toggled.size() * sizeof(uint32_t));
+    for (RoomId r : changed) {
+        const std::vector<Symbol> items = itemList(state.world.rooms[r].items);
+        const uint32_t count = static_cast<uint32_t>(items.size());
+        put(out, &r, sizeof(r));
+        put(out, &count, sizeof(count));
+        put(out, items.data(), items.size() * sizeof(Symbol));
+    }
+    return out;
+}
+
+// Rebuilds a state from a mapped snapshot, checking every index against the world
+static bool decodeSnapshot(const char* bytes, size_t size, const World& world,
+                           SaveState& state, uint64_t& segment, std::string& error) {
+    SnapshotHeader header;
+    if (size < sizeof(header)) {
+        error = "snapshot is truncated";
+        return false;
+    }
+    std::memcpy(&header, bytes, sizeof(header));
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0 ||
+        header.version != kSnapshotVersion) {
+        error = "not a snapshot, or from another version";
+        return false;
+    }
+    if (header.world != world.fingerprint) {
+        error = "snapshot was saved with a different world";
+        return false;
+    }
+
+    size_t pos = sizeof(header);
+    bool ok = true;
+    auto read = [&](void* out, size_t n) {
+        if (!ok || size - pos < n) {
+            ok = false;
+            return;
+        }
+        std::memcpy(out, bytes + pos, n);
+        pos += n;
+    };
+    const size_t rooms = world.roomCount();
+    const size_t symbols = symbolCount();
+
+    SaveState s;
+    s.room = header.room;
+    std::memcpy(s.rng.s, header.random, sizeof(header.random));
+    s.tick = header.tick;
+    s.ambientDue = header.ambientDue;
+    s.weatherDue = header.weatherDue;
+    s.dialogueNode = header.dialogueNode;
+    ok = s.room < rooms && (s.dialogueNode == kNoNode || s.dialogueNode < world.nodeCount()) &&
+         header.visitedWords == (rooms + 63) / 64 &&
+         header.flagWords == (world.flagCount() + 63) / 64 &&
+         header.regions == world.regionCount() &&
+         header.inventoryCount <= size && header.toggledExits <= size;
+    std::vector<Symbol> list(ok ? header.inventoryCount : 0);
+    read(list.data(), list.size() * sizeof(Symbol));
+    for (Symbol item : list) ok = ok && item < symbols;
+    if (ok) addItems(s.inventory, list);
+
+    std::vector<uint64_t> visited(ok ? header.visitedWords : 0);
+    read(visited.data(), visited.size() * sizeof(uint64_t));
+    s.visited = VisitedRooms(visited.size());
+    for (size_t w = 0; ok && w < visited.size(); ++w)
+        if (visited[w]) s.visited.edit(w) = visited[w];
+    s.flags.assign(ok ? header.flagWords : 0, 0);
+    read(s.flags.data(), s.flags.size() * sizeof(uint64_t));
+    s.weather.assign(ok ? header.regions : 0, 0);
+    read(s.weather.data(), s.weather.size() * sizeof(uint32_t));
+
+    s.world = WorldState(world);
+    for (uint32_t i = 0; ok && i < header.toggledExits; ++i) {
+        uint32_t exit = 0;
+        read(&exit, sizeof(exit));
+        ok = ok && exit < world.exitDirection.size();
+        if (ok) s.world.setExitLocked(exit, !s.world.exitLocked(exit));
+    }
+    for (uint32_t i = 0; ok && i < header.changedRooms; ++i) {
+        uint32_t room = 0, count = 0;
+        read(&room, sizeof(room));
+        read(&count, sizeof(count));
+        ok = ok && room < rooms && count <= size;
+        if (!ok) break;
+        RoomChange& changed = s.world.rooms.edit(room);
+        changed.hasItems = true; // may end up empty
+        list.assign(count, kNoSymbol);
+        read(list.data(), count * sizeof(Symbol));
+        for (Symbol item : list) ok = ok && item < symbols;
+        if (ok) addItems(changed.items, list);
+    }
+    if (!ok) {
+        error = "snapshot is corrupt";
+        return false;
+    }
+    segment = header.segment;
+    state = std::move(s);
+    return true;
+}
+
+// ------------ Background compaction ------------
+
+// A copy of the state rather than its encoding: copying shares the rooms and
+// everything else that grows with the world, so the session only pays for
+// the few small vectors, and walking the rooms is left to the compactor
+struct CompactionJob {
+    std::string path;
+    SaveState state;
+    const World* world;
+    uint64_t firstSegment; // segments now covered by the snapshot
+    uint64_t lastSegment;
+};
+
+// One thread encoding and writing snapshots for every session in the
+// process, so a session never waits on the disk for anything but its own
+// journal writes
+struct Compactor {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::deque<CompactionJob> jobs;
+    uint64_t queued = 0;  // jobs pushed so far, which is each job's number
+    uint64_t finished = 0; // written or given up on, in the order pushed
+    bool busy = false;
+    bool stopping = false;
+    std::thread thread;
+
+    Compactor() : thread([this] { run(); }) {}
+    ~Compactor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        thread.join();
+    }
+
+    uint64_t push(CompactionJob job) {
+        uint64_t number;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(std::move(job));
+            number = ++queued;
+        }
+        wake.notify_one();
+        return number;
+    }
+
+    void waitUntilIdle() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return jobs.empty() && !busy; });
+    }
+
+    // Jobs are written in order, so this also waits on any pushed before it
+    void waitFor(uint64_t number) {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this, number] { return finished >= number; });
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty()) return; // stopping with nothing left to write
+            CompactionJob job = std::move(jobs.front());
+            jobs.pop_front();
+            busy = true;
+            lock.unlock();
+            write(job);
+            lock.lock();
+            busy = false;
+            ++finished;
+            idle.notify_all();
+        }
+    }
+
+    static void write(const CompactionJob& job) {
+        const std::vector<char> snapshot = encodeSnapshot(job.state, *job.world, job.lastSegment);
+        const std::string target = job.path + ".snapshot";
+        const std::string temporary = target + ".tmp";
+        std::FILE* f = std::fopen(temporary.c_str(), "wb");
+        if (!f) return;
+        bool ok = std::fwrite(snapshot.data(), 1, snapshot.size(), f) == snapshot.size() &&
+                  std::fflush(f) == 0;
+#ifdef _WIN32
+        ok = ok && _commit(_fileno(f)) == 0;
+#else
+        ok = ok && fsync(fileno(f)) == 0;
+#endif
+        ok = std::fclose(f) == 0 && ok;
+#ifdef _WIN32
+        std::remove(target.c_str()); // rename won't replace a file here
+#endif
+        if (!ok || std::rename(temporary.c_str(), target.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            return; // the old snapshot and every segment are still in place
+        }
+        for (uint64_t n = job.firstSegment; n <= job.lastSegment; ++n)
+            std::remove(segmentPath(job.path, n).c_str());
+    }
+};
+
+static Compactor& compactor() {
+    static Compactor instance;
+    return instance;
+}
+
+void finishCompactions() {
+    compactor().waitUntilIdle();
+}
+
+// ------------ SaveFile ------------
+
+SaveFile::~SaveFile() {
+    commit();
+    if (file) std::fclose(file);
+}
+
+bool SaveFile::open(const std::string& savePath, const World& w, SaveState& state,
+                    bool& hasSnapshot, std::vector<Change>& tail, std::string& error) {
+    path = savePath;
+    world = &w;
+    hasSnapshot = false;
+    tail.clear();
+    snapshotSegment = 0;
+
+    size_t size = 0;
+    std::string missing;
+    std::shared_ptr<const char> snapshot = mapFile(path + ".snapshot", size, missing);
+    if (snapshot) {
+        if (!decodeSnapshot(snapshot.get(), size, w, state, snapshotSegment, error)) {
+            error = path + ".snapshot: " + error;
+            return false;
+        }
+        hasSnapshot = true;
+    }
+
+    // Segments the snapshot covers but that weren't deleted before a crash
+    for (uint64_t n = snapshotSegment; n > 0; --n)
+        if (std::remove(segmentPath(path, n).c_str()) != 0) break;
+
+    // Replay the segments written since, up to the first damaged record
+    bool intact = true;
+    for (segment = snapshotSegment + 1;; ++segment) {
+        size_t length = 0;
+        std::shared_ptr<const char> bytes = mapFile(segmentPath(path, segment), length, missing);
+        if (!bytes) {
+            // mapFile refuses empty files; a segment with no header is just unused
+            std::FILE* f = std::fopen(segmentPath(path, segment).c_str(), "rb");
+            if (!f) break;
+            std::fclose(f);
+            continue;
+        }
+        JournalHeader header;
+        if (length < sizeof(header)) continue;
+        std::memcpy(&header, bytes.get(), sizeof(header));
+        if (std::memcmp(header.magic, kJournalMagic, sizeof(header.magic)) != 0 ||
+            header.world != w.fingerprint) {
+            error = segmentPath(path, segment) + ": journal was saved with a different world";
+            return false;
+        }
+        size_t pos = sizeof(header);
+        Change change;
+        while (intact && decodeChange(bytes.get(), length, pos, change)) tail.push_back(change);
+        if (pos != length) intact = false;
+    }
+    // segment is now the first unused number
+    return startSegment(error);
+}
+
+bool SaveFile::startSegment(std::string& error) {
+    const std::string name = segmentPath(path, segment);
+    file = std::fopen(name.c_str(), "wb");
+    if (!file) {
+        error = "cannot write " + name;
+        return false;
+    }
+    std::setvbuf(file, nullptr, _IONBF, 0); // every fwrite is one write
+    JournalHeader header{};
+    std::memcpy(header.magic, kJournalMagic, sizeof(header.magic));
+    header.world = world->fingerprint;
+    std::fwrite(&header, sizeof(header), 1, file);
+    segmentBytes = sizeof(header);
+    return true;
+}
+
+void SaveFile::append(const Change& change) {
+    encodeChange(change, pending);
+}
+
+void SaveFile::commit() {
+    if (pending.empty()) return;
+    if (file) {
+        std::fwrite(pending.data(), 1, pending.size(), file);
+        segmentBytes += pending.size();
+    }
+    pending.clear();
+}
+
+void SaveFile::compact(const SaveState& state) {
+    commit();
+    if (!file) return;
+    std::fclose(file);
+    file = nullptr;
+
+    CompactionJob job{path, state, world, snapshotSegment + 1, segment};
+    snapshotSegment = segment;
+    ++segment;
+    std::string error;
+    startSegment(error);
+    lastCompaction = compactor().push(std::move(job));
+}
+
+void SaveFile::finishCompaction() {
+    if (lastCompaction) compactor().waitFor(lastCompaction);
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "persistent.h"
+#include "rng.h"
+#include "world.h"
+
+// Every way a session's state can change. Each one is a small fixed-size
+// record, so saving a move costs a few bytes rather than a full dump.
+enum class ChangeType : uint8_t {
+    Move = 1,     // a = room
+    Visit,        // a = room
+    TakeItem,     // a = room, b = item
+    DropItem,     // a = room, b = item
+    GainItem,     // a = item, b = how many, 0 for one
+    LoseItem,     // a = item, b = how many, 0 for every one carried
+    LockExit,     // a = exit, b = 1 to lock or 0 to unlock
+    Flag,         // a = flag, b = 1 to set or 0 to clear
+    Weather,      // a = weather state, b = region
+    Conversation, // a = dialogue node, or kNoNode
+    Random,       // random = generator state
+    Tick,         // a = world tick
+    Timer         // a = which timer (see Session), b = tick it is due, 0 if unset
+};
+
+struct Change {
+    ChangeType type;
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint64_t random[4] = {};
+};
+
+// One bit per room, set once the player has been there
+using VisitedRooms = PersistentArray<uint64_t, 3>;
+
+// A session's whole state, as stored in a snapshot or kept to rewind to.
+// What grows with the rooms is in persistent arrays, so copying a state
+// costs about as much as the player's inventory, flags and the weather of
+// the regions, of which there are a thousand times fewer.
+struct SaveState {
+    RoomId room = 0;
+    ItemSet inventory;
+    VisitedRooms visited;
+    std::vector<uint64_t> flags; // one bit per World::flagName
+    std::vector<uint32_t> weather; // per region
+    uint32_t tick = 0;
+    uint32_t ambientDue = 0; // ticks the session's timers are due, 0 if unset
+    uint32_t weatherDue = 0;
+    uint32_t dialogueNode = kNoNode;
+    Rng rng;
+    WorldState world;
+};
+
+// Progress of one session on disk, kept under a path prefix:
+//
+//   <path>.snapshot     the state as of some point, stored as a difference
+//                       from the pristine world (only exits whose lock
+//                       changed and rooms whose items changed)
+//   <path>.journal.<n>  numbered segments of Change records made since
+//
+// Records are appended as they happen and written out once per command. When
+// the current segment grows past a limit, the session starts the next segment
+// and hands a copy of its state to a background thread, which encodes the
+// snapshot, writes it under a temporary name, renames it into place, and only
+// then deletes the segments it covers. A crash at any point leaves a snapshot plus the segments needed
+// to reach the latest state.
+struct SaveFile {
+    SaveFile() = default;
+    SaveFile(const SaveFile&) = delete;
+    SaveFile& operator=(const SaveFile&) = delete;
+    ~SaveFile();
+
+    // Reads whatever is saved under path. If a snapshot exists, state is set
+    // from it and hasSnapshot is true. Changes made after the snapshot are
+    // placed in tail, oldest first. A torn or corrupt record ends the tail.
+    // Afterwards, new records go to a fresh segment.
+    bool open(const std::string& path, const World& world, SaveState& state,
+              bool& hasSnapshot, std::vector<Change>& tail, std::string& error);
+
+    void append(const Change& change);
+    // Writes the records appended since the last commit with one write
+    void commit();
+
+    bool wantsCompaction() const { return segmentBytes >= kCompactAfter; }
+    // True while segments from before open() are still on disk
+    bool hasBacklog() const { return segment > snapshotSegment + 1; }
+    // Starts a new segment and queues a snapshot of state, which covers
+    // everything before it. The world must outlive the snapshot being written.
+    void compact(const SaveState& state);
+    // Blocks until the snapshots this file queued have been written
+    void finishCompaction();
+
+    static const size_t kCompactAfter = 64 * 1024;
+
+private:
+    bool startSegment(std::string& error);
+
+    std::string path;
+    const World* world = nullptr;
+    uint64_t segment = 0;         // number of the segment being written
+    uint64_t snapshotSegment = 0; // segments up to this one are in the snapshot
+    std::FILE* file = nullptr;
+    std::vector<char> pending;    // records not yet written
+    size_t segmentBytes = 0;
+    uint64_t lastCompaction = 0;  // the compactor's number for it, 0 for none
+};
+
+// Blocks until every queued snapshot has been written
+void finishCompactions();
@@ -0,0 +1,130 @@
+#include "scheduler.h"
+
+#include <algorithm> // std::max, std::sort
+#include <cstddef>   // std::ptrdiff_t
+
+void TimerWheel::reset(uint32_t now) {
+    nodes.clear();
+    freeNodes.clear();
+    heads.fill(kNoTimer);
+    regionHeads.clear();
+    clock = now;
+}
+
+uint32_t TimerWheel::schedule(const Timer& timer) {
+    uint32_t id;
+    if (!freeNodes.empty()) {
+        id = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        id = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+        // Lists that can hold every node grow with the pool, so a wheel that
+        // has stopped growing never allocates
+        freeNodes.reserve(nodes.capacity());
+        moving.reserve(nodes.capacity());
+    }
+    Node& node = nodes[id];
+    node.timer = timer;
+    node.regionPrev = kNoTimer;
+    auto head = regionHeads.try_emplace(timer.region, kNoTimer).first;
+    node.regionNext = head->second;
+    if (node.regionNext != kNoTimer) nodes[node.regionNext].regionPrev = id;
+    head->second = id;
+    place(id, clock + 1);
+    return id;
+}
+
+// Files a timer under the finest level whose slots still tell its tick apart
+// from the clock's: level 0 if both fall in the same run of 64 ticks, and so
+// on. Timers due before earliest are filed under it.
+void TimerWheel::place(uint32_t id, uint32_t earliest) {
+    Node& node = nodes[id];
+    const uint32_t tick = std::max(node.timer.due, earliest);
+    const uint32_t apart = tick ^ clock;
+    uint32_t list = kOverflow;
+    for (uint32_t level = 0, shift = 0; level < kLevels; ++level, shift += 6) {
+        if (apart < uint32_t{kSlots} << shift) {
+            list = level * kSlots + ((tick >> shift) & (kSlots - 1));
+            break;
+        }
+    }
+    node.list = list;
+    node.prev = kNoTimer;
+    node.next = heads[list];
+    if (node.next != kNoTimer) nodes[node.next].prev = id;
+    heads[list] = id;
+}
+
+void TimerWheel::unlink(uint32_t id) {
+    Node& node = nodes[id];
+    if (node.prev != kNoTimer) nodes[node.prev].next = node.next;
+    else heads[node.list] = node.next;
+    if (node.next != kNoTimer) nodes[node.next].prev = node.prev;
+}
+
+void TimerWheel::release(uint32_t id) {
+    unlink(id);
+    Node& node = nodes[id];
+    if (node.regionPrev != kNoTimer) {
+        nodes[node.regionPrev].regionNext = node.regionNext;
+    } else {
+        // An emptied region keeps its entry, so scheduling there again
+        // doesn't allocate
+        regionHeads[node.timer.region] = node.regionNext;
+    }
+    if (node.regionNext != kNoTimer) nodes[node.regionNext].regionPrev = node.regionPrev;
+    node.list = kFree;
+    freeNodes.push_back(id);
+}
+
+void TimerWheel::cancel(uint32_t id) {
+    if (id < nodes.size() && nodes[id].list != kFree) release(id);
+}
+
+void TimerWheel::cancelRegion(uint32_t region) {
+    auto head = regionHeads.find(region);
+    if (head == regionHeads.end()) return;
+    for (uint32_t id = head->second; id != kNoTimer;) {
+        const uint32_t next = nodes[id].regionNext;
+        release(id); // moves head on, so the walk keeps its own place
+        id = next;
+    }
+}
+
+// Empties a slot of a coarser level (or the overflow list) back into the wheel
+void TimerWheel::cascade(uint32_t list) {
+    moving.clear();
+    for (uint32_t id = heads[list]; id != kNoTimer; id = nodes[id].next) moving.push_back(id);
+    heads[list] = kNoTimer;
+    for (uint32_t id : moving) place(id, clock); // the slot for clock hasn't run yet
+}
+
+void TimerWheel::advance(uint32_t now, std::vector<Timer>& fired) {
+    const size_t first = fired.size();
+    fired.reserve(first + nodes.size()); // room for every timer there is
+    while (clock < now) {
+        ++clock;
+        // Crossing into a new run of a level's range brings its next slot down
+        if ((clock & (kSlots - 1)) == 0) {
+            if ((clock & (kSlots * kSlots - 1)) == 0) {
+                if ((clock & (kSlots * kSlots * kSlots - 1)) == 0) cascade(kOverflow);
+                cascade(2 * kSlots + ((clock >> 12) & (kSlots - 1)));
+            }
+            cascade(kSlots + ((clock >> 6) & (kSlots - 1)));
+        }
+        for (uint32_t id = heads[clock & (kSlots - 1)]; id != kNoTimer;) {
+            const uint32_t next = nodes[id].next;
+            fired.push_back(nodes[id].timer);
+            release(id);
+            id = next;
+        }
+    }
+    std::sort(fired.begin() + static_cast<std::ptrdiff_t>(first), fired.end(),
+              [](const Timer& a, const Timer& b) {
+                  if (a.region != b.region) return a.region < b.region;
+                  if (a.kind != b.kind) return a.kind < b.kind;
+                  if (a.arg != b.arg) return a.arg < b.arg;
+                  return a.due < b.due;
+              });
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+constexpr uint32_t kNoTimer = UINT32_MAX;
+
+struct Timer {
+    uint32_t due = 0;    // world tick it fires on
+    uint32_t kind = 0;   // what to do, up to whoever scheduled it
+    uint32_t arg = 0;
+    uint32_t region = 0; // timers are grouped and cancelled by region
+};
+
+// Timers on a count of world ticks, kept in a hierarchical wheel: three
+// levels of 64 slots cover the next 64, 4096 and 262144 ticks, and anything
+// further out waits in an overflow list. A timer sits on the finest level
+// that can still tell its tick apart from now, and moves down a level when
+// that level's slot comes round, so a tick with nothing due only looks at
+// one slot, and scheduling or cancelling costs the same with ten timers as
+// with ten thousand. Timers are also linked per region, so everything a
+// region has scheduled can be dropped at once when nobody is left there.
+struct TimerWheel {
+    explicit TimerWheel(uint32_t now = 0) { reset(now); }
+
+    // Drops every timer and sets the clock
+    void reset(uint32_t now);
+    uint32_t now() const { return clock; }
+
+    // Returns an id for cancel(). Ids are reused once their timer fires or is
+    // cancelled. A timer due at or before now fires on the next advance.
+    uint32_t schedule(const Timer& timer);
+    void cancel(uint32_t id);
+    void cancelRegion(uint32_t region);
+
+    // Moves the clock on to now and appends the timers that came due,
+    // grouped by region and ordered by kind, then argument, within each
+    void advance(uint32_t now, std::vector<Timer>& fired);
+
+private:
+    static const uint32_t kSlots = 64;
+    static const uint32_t kLevels = 3;
+    static const uint32_t kOverflow = kLevels * kSlots; // list index
+    static const uint32_t kFree = UINT32_MAX;
+
+    struct Node {
+        Timer timer;
+        uint32_t list = kFree;  // wheel slot, kOverflow or kFree
+        uint32_t prev = kNoTimer, next = kNoTimer;
+        uint32_t regionPrev = kNoTimer, regionNext = kNoTimer;
+    };
+
+    void place(uint32_t id, uint32_t earliest);
+    void unlink(uint32_t id);
+    void release(uint32_t id);
+    void cascade(uint32_t list);
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;
+    std::array<uint32_t, kOverflow + 1> heads;          // first node of each list
+    std::unordered_map<uint32_t, uint32_t> regionHeads; // first node of each region, or kNoTimer
+    std::vector<uint32_t> moving; // scratch for cascade
+    uint32_t clock = 0;
+};
@@ -0,0 +1,403 @@
+#include "server.h"
+
+#ifdef _WIN32
+
+bool serveSessions(const Game&, const std::string&, unsigned, bool, std::string& error) {
+    error = "serving sessions needs Unix-domain sockets, which this build lacks";
+    return false;
+}
+
+bool checkPipelining(const Game&, size_t, std::string& error) {
+    error = "serving sessions needs Unix-domain sockets, which this build lacks";
+    return false;
+}
+
+#else
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>       // std::strerror
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Longest line a client may send; anything longer drops the connection
+static const size_t kMaxLine = 4096;
+
+// Most output held for a client that isn't reading it. Past this, its lines
+// wait unanswered and its socket isn't read, so a client sending faster than
+// it reads is held back by its own socket buffers instead of growing ours.
+static const size_t kMaxOut = size_t{1} << 20;
+
+struct Connection {
+    int fd = -1;
+    std::unique_ptr<Session> session;
+    std::string in;  // received but not yet answered: whole lines, then part of one
+    std::string out; // waiting to be sent
+    bool ended = false;   // the client has sent all it will
+    bool closing = false; // close once out has been sent
+    bool dead = false;    // close now
+
+    bool full() const { return out.size() >= kMaxOut; }
+};
+
+// One thread and the connections it owns. New connections are handed over
+// through `incoming`, and a byte on the wake pipe interrupts poll(). Setting
+// `stopping` and waking the worker makes it close its connections and return.
+struct Worker {
+    const Game* game = nullptr;
+    bool ansi = true;
+    Rng rng; // each session gets a split of this stream
+    int wake[2] = {-1, -1};
+    std::mutex mutex;
+    std::vector<int> incoming;
+    bool stopping = false;
+    std::thread thread;
+
+    void run();
+    void wakeUp();
+};
+
+static void setNonBlocking(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+// Runs complete lines in c.in through the session until the output is full.
+// Once the client has ended and every whole line is answered, the
+// connection closes.
+static void runLines(Connection& c) {
+    size_t begin = 0;
+    for (size_t nl; !c.closing && !c.full() && (nl = c.in.find('\n', begin)) != std::string::npos;
+         begin = nl + 1) {
+        std::string_view line(c.in.data() + begin, nl - begin);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        c.out += c.session->handle(line);
+        if (c.session->finished()) c.closing = true;
+    }
+    c.in.erase(0, begin);
+    if (c.ended && c.in.find('\n') == std::string::npos) c.closing = true;
+    if (c.closing && c.out.empty()) c.dead = true;
+}
+
+// Reads what has arrived and runs every complete line through the session,
+// until the output is full. A client that closes its side still gets the
+// answers to what it sent.
+static void receive(Connection& c) {
+    char buffer[4096];
+    while (!c.closing && !c.ended && !c.full()) {
+        ssize_t n = ::read(c.fd, buffer, sizeof(buffer));
+        if (n > 0) {
+            c.in.append(buffer, static_cast<size_t>(n));
+            runLines(c);
+            // Only the line still arriving counts; whole ones may be waiting
+            if (c.in.size() - (c.in.rfind('\n') + 1) > kMaxLine) {
+                c.dead = true;
+                return;
+            }
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) {
+            c.dead = true; // a real error
+            return;
+        }
+        c.ended = true;
+        runLines(c);
+    }
+}
+
+static void send(Connection& c) {
+    while (!c.out.empty()) {
+        ssize_t n = ::write(c.fd, c.out.data(), c.out.size());
+        if (n > 0) {
+            c.out.erase(0, static_cast<size_t>(n));
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (n < 0 && errno == EINTR) continue;
+        c.dead = true;
+        return;
+    }
+    if (c.closing) c.dead = true;
+}
+
+void Worker::wakeUp() {
+    const char wakeByte = 1;
+    if (::write(wake[1], &wakeByte, 1) < 0) {
+        // The pipe is full, so the worker is already due to wake up
+    }
+}
+
+void Worker::run() {
+    std::vector<Connection> connections;
+    std::vector<pollfd> fds;
+    bool stop = false;
+
+    while (!stop) {
+        fds.clear();
+        fds.push_back({wake[0], POLLIN, 0});
+        for (const Connection& c : connections) {
+            // Once closing, only what is left to send matters, and while
+            // the output is full nothing more is read
+            const short in = c.closing || c.ended || c.full() ? 0 : POLLIN;
+            const short events = c.out.empty() ? in : in | POLLOUT;
+            fds.push_back({c.fd, events, 0});
+        }
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        // Events for connections that existed when poll() was called
+        for (size_t i = 1; i < fds.size(); ++i) {
+            Connection& c = connections[i - 1];
+            if (c.closing) {
+                if (fds[i].revents & (POLLHUP | POLLERR)) c.dead = true;
+            } else if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                receive(c);
+            }
+            if (c.dead || c.out.empty()) continue;
+            const bool wasFull = c.full();
+            send(c);
+            // Lines held back while the output was full are answered now,
+            // and reading resumes once they all are
+            if (!c.dead && wasFull && !c.full()) runLines(c);
+        }
+
+        if (fds[0].revents & POLLIN) {
+            char drain[64];
+            while (::read(wake[0], drain, sizeof(drain)) > 0) {}
+            std::vector<int> accepted;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                accepted.swap(incoming);
+                stop = stopping;
+            }
+            for (int fd : accepted) {
+                setNonBlocking(fd);
+                Connection c;
+                c.fd = fd;
+                c.session = std::make_unique<Session>(*game, rng.split(), ansi);
+                c.out += c.session->start();
+                send(c);
+                connections.push_back(std::move(c));
+            }
+        }
+
+        for (size_t i = 0; i < connections.size();) {
+            if (connections[i].dead) {
+                ::close(connections[i].fd);
+                connections[i] = std::move(connections.back());
+                connections.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    for (Connection& c : connections) ::close(c.fd);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int fd : incoming) ::close(fd);
+    incoming.clear();
+}
+
+// Stops every worker, waits for it to finish and closes its pipe
+static void stopWorkers(std::vector<std::unique_ptr<Worker>>& pool) {
+    for (auto& worker : pool) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->stopping = true;
+        }
+        worker->wakeUp();
+    }
+    for (auto& worker : pool) {
+        worker->thread.join();
+        ::close(worker->wake[0]);
+        ::close(worker->wake[1]);
+    }
+    pool.clear();
+}
+
+bool serveSessions(const Game& game, const std::string& path, unsigned workers,
+                   bool ansi, std::string& error) {
+    // A client hanging up mid-write should fail that write, not end the process
+    std::signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        error = "socket path is too long: " + path;
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    // A socket left over from an earlier run is replaced; anything else at
+    // the path is left alone
+    struct stat existing;
+    if (::lstat(path.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            error = path + " exists and is not a socket";
+            return false;
+        }
+        ::unlink(path.c_str());
+    }
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        error = std::string("cannot create socket: ") + std::strerror(errno);
+        return false;
+    }
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, SOMAXCONN) != 0) {
+        error = "cannot listen on " + path + ": " + std::strerror(errno);
+        ::close(listener);
+        return false;
+    }
+
+    // One fresh seed for the whole server; workers take long jumps from it
+    std::random_device entropy;
+    Rng streams((uint64_t{entropy()} << 32) | entropy());
+
+    if (workers == 0) workers = 1;
+    std::vector<std::unique_ptr<Worker>> pool;
+    for (unsigned i = 0; i < workers; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->game = &game;
+        worker->ansi = ansi;
+        worker->rng = streams;
+        streams.longJump();
+        if (::pipe(worker->wake) != 0) {
+            error = std::string("cannot create pipe: ") + std::strerror(errno);
+            stopWorkers(pool);
+            ::close(listener);
+            return false;
+        }
+        setNonBlocking(worker->wake[0]);
+        setNonBlocking(worker->wake[1]);
+        worker->thread = std::thread(&Worker::run, worker.get());
+        pool.push_back(std::move(worker));
+    }
+
+    // Hand connections to the workers in turn
+    for (size_t next = 0;; next = (next + 1) % pool.size()) {
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno == EMFILE || errno == ENFILE) {
+                // Out of descriptors until someone disconnects
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            error = std::string("accept failed: ") + std::strerror(errno);
+            break;
+        }
+        Worker& worker = *pool[next];
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.incoming.push_back(fd);
+        }
+        worker.wakeUp();
+    }
+
+    ::close(listener);
+    stopWorkers(pool);
+    return false;
+}
+
+bool checkPipelining(const Game& game, size_t lines, std::string& error) {
+    std::signal(SIGPIPE, SIG_IGN);
+    int pair[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+        error = std::string("cannot create socket pair: ") + std::strerror(errno);
+        return false;
+    }
+    std::vector<std::unique_ptr<Worker>> pool;
+    pool.push_back(std::make_unique<Worker>());
+    Worker& worker = *pool.back();
+    worker.game = &game;
+    worker.ansi = false;
+    if (::pipe(worker.wake) != 0) {
+        error = std::string("cannot create pipe: ") + std::strerror(errno);
+        ::close(pair[0]);
+        ::close(pair[1]);
+        return false;
+    }
+    setNonBlocking(worker.wake[0]);
+    setNonBlocking(worker.wake[1]);
+    worker.incoming.push_back(pair[0]);
+    worker.thread = std::thread(&Worker::run, &worker);
+    worker.wakeUp();
+
+    // Padded so that what is sent outruns the socket's buffers long before
+    // the answers fill the server's
+    std::string line = "look";
+    line.append(kMaxLine / 8, ' ').push_back('\n');
+    std::atomic<size_t> sent{0};
+    std::thread client([&] {
+        for (size_t i = 0; i < lines; ++i) {
+            for (size_t at = 0; at < line.size();) {
+                const ssize_t n = ::write(pair[1], line.data() + at, line.size() - at);
+                if (n < 0 && errno == EINTR) continue;
+                if (n <= 0) return;
+                at += static_cast<size_t>(n);
+            }
+            sent = i + 1;
+        }
+        ::shutdown(pair[1], SHUT_WR);
+    });
+
+    // Nothing is read until the client has been stuck for a while, or has
+    // sent everything, which the server should not have let it do
+    for (size_t last = SIZE_MAX, still = 0; still < 5 && sent < lines; ++still) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (sent != last) still = 0;
+        last = sent;
+    }
+    const size_t sentUnread = sent;
+
+    // Every line is still answered once the client reads
+    size_t prompts = 0, answered = 0;
+    char buffer[4096], previous = '\n';
+    for (ssize_t n; (n = ::read(pair[1], buffer, sizeof(buffer))) != 0;) {
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        answered += static_cast<size_t>(n);
+        for (ssize_t i = 0; i < n; previous = buffer[i++])
+            prompts += previous == '\n' && buffer[i] == '>';
+    }
+    client.join();
+    ::close(pair[1]);
+    stopWorkers(pool);
+
+    if (sentUnread >= lines && answered <= kMaxOut) {
+        error = "the answers to " + std::to_string(lines) + " lines fit in what the server holds; send more";
+        return false;
+    }
+    if (sentUnread >= lines) {
+        error = "the server took all " + std::to_string(lines) + " lines without its answers being read";
+        return false;
+    }
+    // The welcome ends in a prompt too
+    if (prompts != lines + 1) {
+        error = std::to_string(prompts - std::min<size_t>(prompts, 1)) + " of " + std::to_string(lines) +
+                " lines were answered";
+        return false;
+    }
+    return true;
+}
+
+#endif
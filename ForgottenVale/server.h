@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "session.h"
+
+// Hosts sessions for clients connecting to a Unix-domain socket at path. Each
+// connection gets its own Session and talks to it line by line, exactly as a
+// player would at the console. Connections are spread over `workers` threads,
+// each multiplexing its share with poll(), so one process can serve thousands
+// of players against a single shared Game. With ansi off, sessions send plain
+// text without colours or screen clears.
+//
+// A socket left at path by an earlier run is replaced, but any other file
+// there is an error. Only returns if the socket can't be set up or stops
+// accepting, with error describing why, once every worker has finished.
+bool serveSessions(const Game& game, const std::string& path, unsigned workers,
+                   bool ansi, std::string& error);
+
+// Serves one connection that sends `lines` looks without reading any answers,
+// and fails with error unless the server stops reading it before they have
+// all been sent, yet answers every one once the client reads
+bool checkPipelining(const Game& game, size_t lines, std::string& error);
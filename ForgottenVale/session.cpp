@@ -0,0 +1,1047 @@
+#include "session.h"
+
+#include <algorithm>     // std::find, std::find_if, std::all_of, std::min
+#include <cctype>        // std::toupper
+#include <iterator>      // std::size
+
+#include "symbols.h"    // interned names
+#include "worldfile.h"  // loading worlds from disk
+
+// Writes a name with its first letter capitalized, for nicer inventory output
+static void writeCapitalized(Frame& f, std::string_view s) {
+    if (s.empty()) return;
+    f << static_cast<char>(std::toupper(static_cast<unsigned char>(s[0]))) << s.substr(1);
+}
+
+// Names the game logic refers to directly. Bound once the world is loaded so
+// that the world's own names keep the IDs they were stored with.
+static Symbol SYM_MAP, SYM_STONE;
+
+static void bindSymbols() {
+    SYM_MAP   = intern("map");
+    SYM_STONE = intern("stone");
+}
+
+bool loadGame(const std::string& path, Game& game, std::string& error) {
+    if (!loadWorld(path, game.world, error)) return false;
+    prepareGame(game);
+    return true;
+}
+
+void prepareGame(Game& game) {
+    bindSymbols();
+
+    // Word groups used to recognise commands and tolerate slight typos,
+    // plus every action's name, indexed once for every session
+    CommandIndex& commands = game.commands;
+    commands.addVerb(Verb::Look, {"look", "examine", "inspect"});
+    commands.addVerb(Verb::Go, {"go", "move", "walk"});
+    commands.addVerb(Verb::Travel, {"travel", "goto", "journey"});
+    commands.addVerb(Verb::Take, {"take", "get", "pickup", "pick", "grab"});
+    commands.addVerb(Verb::Drop, {"drop", "leave"});
+    commands.addVerb(Verb::Use, {"use", "do", "open"});
+    commands.addVerb(Verb::Combine, {"combine", "craft"});
+    commands.addVerb(Verb::Inventory, {"inventory", "inv", "i"});
+    commands.addVerb(Verb::Talk, {"talk", "speak", "chat"});
+    commands.addVerb(Verb::Help, {"help", "?"});
+    commands.addVerb(Verb::Exit, {"exit", "quit"});
+    commands.addVerb(Verb::Rewind, {"rewind", "undo"});
+    commands.addActions(game.world.actionName, game.world.actionStart);
+    commands.build();
+    game.routes.build(game.world);
+    game.recipes.build(game.world);
+    game.rules.build(game.world);
+    game.npcs.build(npcSchedules(game.world));
+    game.pager->start(game.world); // last, once nothing else reads the whole world
+}
+
+// --- Dynamic weather ---
+static const char* const weatherStates[] = {
+    "clear skies",
+    "low mist",
+    "light drizzle",
+    "steady rain",
+    "overcast clouds"
+};
+
+// Ambient sounds heard now and then in every region
+static const char* const ambientEvents[] = {
+    "A raven caws in the distance.",
+    "The wind rustles through the trees.",
+    "A distant howl echoes across the vale.",
+    "Leaves crunch somewhere nearby.",
+    "You hear the flap of wings overhead."
+};
+
+// Ambient sounds come every 4 to 24 ticks, about as often as the old 7%
+// chance per command gave; weather holds for 10 to 30
+static uint32_t ambientDelay(Rng& rng) { return 4 + rng.below(21); }
+static uint32_t weatherDelay(Rng& rng) { return 10 + rng.below(21); }
+
+// Names of the NPCs in a room, "a, b and c", shortened to a count past a
+// handful so a crowded square stays one line
+static void listNpcs(Frame& f, const World& world, Span<uint32_t> npcs, const char* conjunction) {
+    const size_t kListed = 5;
+    const size_t named = npcs.size() > kListed + 1 ? kListed : npcs.size();
+    for (size_t i = 0; i < named; ++i) {
+        if (i > 0) f << (i + 1 == npcs.size() ? conjunction : ", ");
+        f << symbolText(world.npcName[npcs[i]]);
+    }
+    if (named < npcs.size()) f << conjunction << npcs.size() - named << " others";
+}
+
+static const char* const stoneJokes[] = {
+    "You attempt to juggle the stone, but it immediately drops on your foot.",
+    "You proudly present the stone to the air as if it were a rare gem.",
+    "You balance the stone on your head for a moment before it tumbles off."
+};
+
+Session::Session(const Game& game, Rng rng, bool ansi)
+    : game(&game),
+      state(game.world),
+      current{&game.world, &state, game.world.startRoom},
+      visitedRooms((game.world.roomCount() + 63) / 64),
+      flags((game.world.flagCount() + 63) / 64),
+      weather(game.world.regionCount()),
+      rng(rng) {
+    out.ansi = ansi;
+    followRegion();
+    // Every checkpoint already has room for what it copies, so taking one
+    // only copies into buffers it holds
+    checkpoints.resize(kCheckpoints);
+    for (SaveState& c : checkpoints) {
+        c.inventory.reserve(ItemSet::kLinearLimit);
+        c.flags.resize(flags.size());
+        c.weather.resize(weather.size());
+    }
+}
+
+Session::~Session() {
+    if (pagedRegion != kNoRegion) game->pager->leave(pagedRegion);
+}
+
+void Session::prompt() {
+    out << "\n" << Colour::Cyan << "> " << Colour::Reset;
+}
+
+std::string_view Session::start() {
+    out.clear();
+    out << Colour::Bold << "Welcome to Whispers of the Forgotten Vale." << Colour::Reset << "\n";
+    out << "Type 'help' for commands, 'exit' to quit." << "\n\n";
+    resetTimers(); // a restored game picks up its own
+    if (!ambientDue) change({ChangeType::Timer, TimerAmbient, ticks + ambientDelay(rng)});
+    if (!weatherDue) change({ChangeType::Timer, TimerWeather, ticks + weatherDelay(rng)});
+    showRoom(current);
+    if (dialogueNode != kNoNode) showDialogue(); // saved mid-conversation
+    else prompt();
+    commitChanges();
+    return out.text();
+}
+
+std::string_view Session::handle(std::string_view line) {
+    out.reset();
+    if (done) return out.text();
+    respond(line);
+    scratch.reset();
+    commitChanges();
+    return out.text();
+}
+
+void Session::respond(std::string_view line) {
+    if (dialogueNode != kNoNode) {
+        chooseDialogueOption(line);
+        if (dialogueNode != kNoNode) return;
+        // The conversation is over; pick up where the command left off
+        out.clear();
+        showRoom(current);
+        tick();
+        prompt();
+        return;
+    }
+
+    // Split the command into individual words and drop filler like 'the';
+    // commands aren't case sensitive
+    const Span<std::string_view> words = splitCommand(line, scratch);
+    if (words.empty()) {
+        prompt();
+        return;
+    }
+
+    const bool timePassed = command(words);
+    if (done || dialogueNode != kNoNode) return;
+    if (timePassed) tick();
+    prompt();
+}
+
+// ------------ Saving ------------
+
+void Session::change(const Change& c) {
+    apply(c);
+    if (save) save->append(c);
+}
+
+bool Session::apply(const Change& c) {
+    const World& world = game->world;
+    switch (c.type) {
+    case ChangeType::Move:
+        if (c.a >= world.roomCount()) return false;
+        current = Room{&world, &state, c.a};
+        followRegion();
+        return true;
+    case ChangeType::Visit:
+        if (c.a >= world.roomCount()) return false;
+        visitedRooms.edit(c.a >> 6) |= uint64_t{1} << (c.a & 63);
+        return true;
+    case ChangeType::TakeItem: {
+        if (c.a >= world.roomCount()) return false;
+        if (!Room{&world, &state, c.a}.takeItem(c.b)) return false;
+        inventory.add(c.b);
+        return true;
+    }
+    case ChangeType::DropItem: {
+        if (c.a >= world.roomCount()) return false;
+        if (!inventory.remove(c.b)) return false;
+        Room{&world, &state, c.a}.addItem(c.b);
+        return true;
+    }
+    case ChangeType::GainItem:
+        if (c.a >= symbolCount()) return false;
+        inventory.add(c.a, c.b == 0 ? 1 : c.b);
+        return true;
+    case ChangeType::LoseItem:
+        inventory.remove(c.a, c.b == 0 ? UINT32_MAX : c.b);
+        return true;
+    case ChangeType::LockExit:
+        if (c.a >= world.exitDirection.size()) return false;
+        state.setExitLocked(c.a, c.b != 0);
+        state.touchRoom(world.exitRoom(c.a));
+        return true;
+    case ChangeType::Flag: {
+        if (c.a >= world.flagCount()) return false;
+        const uint64_t bit = uint64_t{1} << (c.a & 63);
+        if (c.b) flags[c.a >> 6] |= bit;
+        else flags[c.a >> 6] &= ~bit;
+        return true;
+    }
+    case ChangeType::Weather:
+        if (c.a >= std::size(weatherStates) || c.b >= weather.size()) return false;
+        weather[c.b] = c.a;
+        return true;
+    case ChangeType::Conversation:
+        if (c.a != kNoNode && c.a >= world.nodeCount()) return false;
+        dialogueNode = c.a;
+        return true;
+    case ChangeType::Random:
+        std::copy(std::begin(c.random), std::end(c.random), rng.s);
+        return true;
+    case ChangeType::Tick:
+        ticks = c.a;
+        return true;
+    case ChangeType::Timer:
+        // The wheel is rebuilt from the due ticks after a replay, so while
+        // replaying it only needs to be consistent, not right
+        if (c.a == TimerAmbient) {
+            ambientDue = c.b;
+            timers.cancel(ambientTimer);
+            ambientTimer = c.b ? timers.schedule({c.b, TimerAmbient, 0, kNoRegion}) : kNoTimer;
+        } else if (c.a == TimerWeather) {
+            weatherDue = c.b;
+            timers.cancel(weatherTimer);
+            weatherTimer = c.b ? timers.schedule({c.b, TimerWeather, 0, timedRegion}) : kNoTimer;
+        } else {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+SaveState Session::saveState() const {
+    SaveState saved;
+    saveState(saved);
+    return saved;
+}
+
+void Session::saveState(SaveState& saved) const {
+    saved.room = current.id;
+    saved.inventory = inventory;
+    saved.visited = visitedRooms;
+    saved.flags = flags;
+    saved.weather = weather;
+    saved.tick = ticks;
+    saved.ambientDue = ambientDue;
+    saved.weatherDue = weatherDue;
+    saved.dialogueNode = dialogueNode;
+    saved.rng = rng;
+    saved.world = state;
+}
+
+void Session::restore(const SaveState& saved) {
+    state = saved.world;
+    renderedRooms.fill(RenderedRoom{}); // versions start again with the new state
+    current = Room{&game->world, &state, saved.room};
+    followRegion();
+    inventory = saved.inventory;
+    visitedRooms = saved.visited;
+    flags = saved.flags;
+    weather.assign(game->world.regionCount(), 0);
+    for (uint32_t r = 0; r < saved.weather.size(); ++r) apply({ChangeType::Weather, saved.weather[r], r});
+    ticks = saved.tick;
+    ambientDue = saved.ambientDue;
+    weatherDue = saved.weatherDue;
+    apply({ChangeType::Conversation, saved.dialogueNode});
+    rng = saved.rng;
+}
+
+bool Session::attachSave(const std::string& path, std::string& error) {
+    auto file = std::make_unique<SaveFile>();
+    SaveState saved;
+    bool hasSnapshot = false;
+    std::vector<Change> tail;
+    if (!file->open(path, game->world, saved, hasSnapshot, tail, error)) return false;
+
+    if (hasSnapshot) restore(saved);
+    for (const Change& c : tail) {
+        if (!apply(c)) break; // the journal doesn't fit this world any more
+    }
+    save = std::move(file);
+    journaledRng = rng;
+    journaledTicks = ticks;
+    // Fold what was replayed into a fresh snapshot before play continues
+    if (save->hasBacklog()) {
+        save->compact(saveState());
+        save->finishCompaction();
+    }
+    return true;
+}
+
+// Called once per response: the tick and the generator's state go in last,
+// so replaying a journal leaves them exactly where the game left them
+void Session::commitChanges() {
+    if (!save) return;
+    if (ticks != journaledTicks) {
+        save->append({ChangeType::Tick, ticks});
+        journaledTicks = ticks;
+    }
+    if (!std::equal(std::begin(rng.s), std::end(rng.s), std::begin(journaledRng.s))) {
+        Change c{ChangeType::Random};
+        std::copy(std::begin(rng.s), std::end(rng.s), c.random);
+        save->append(c);
+        journaledRng = rng;
+    }
+    save->commit();
+    if (done || save->wantsCompaction()) save->compact(saveState());
+}
+
+// ------------ Rewinding ------------
+
+void Session::checkpoint() {
+    size_t slot = (firstCheckpoint + checkpointCount) % kCheckpoints;
+    if (checkpointCount < kCheckpoints) ++checkpointCount;
+    else firstCheckpoint = (firstCheckpoint + 1) % kCheckpoints; // the oldest goes
+    saveState(checkpoints[slot]);
+}
+
+// "undo" goes back one command and "rewind 3" three, as far as the
+// checkpoints reach: only commands played since the session started or
+// resumed, and no more than kCheckpoints of them. Asking for more goes as
+// far as they reach. Commands undone can't be redone: the next one taken
+// replaces them. A saved game gets a fresh snapshot at once, so this is the
+// one command that waits for the disk.
+void Session::rewind(Span<std::string_view> words) {
+    size_t steps = 1;
+    if (words.size() >= 2) {
+        const std::string_view n = words[1];
+        const bool number = n.find_first_not_of("0123456789") == std::string_view::npos;
+        steps = 0;
+        // Saturates past the checkpoints there can be, so no count overflows
+        for (char c : n) steps = number ? std::min(steps * 10 + static_cast<size_t>(c - '0'), kCheckpoints + 1) : 0;
+        if (steps == 0) {
+            out << "Rewind how far? Try 'rewind 3'.\n";
+            return;
+        }
+    }
+    if (checkpointCount == 0) {
+        out << "There is nothing to undo.\n";
+        return;
+    }
+    steps = std::min(steps, checkpointCount);
+    checkpointCount -= steps;
+    restore(checkpoints[(firstCheckpoint + checkpointCount) % kCheckpoints]);
+    resetTimers();
+    if (save) {
+        save->compact(saveState());
+        save->finishCompaction();
+        journaledRng = rng;
+        journaledTicks = ticks;
+    }
+    out.clear();
+    out << "Time folds back " << steps << (steps == 1 ? " command.\n\n" : " commands.\n\n");
+    showRoom(current);
+}
+
+std::unique_ptr<Session> Session::fork() const {
+    auto copy = std::make_unique<Session>(*game, rng, out.ansi);
+    copy->restore(saveState());
+    copy->checkpoints = checkpoints;
+    copy->firstCheckpoint = firstCheckpoint;
+    copy->checkpointCount = checkpointCount;
+    copy->resetTimers();
+    return copy;
+}
+
+// Display the current room description along with items and exits
+void Session::showRoom(Room room) {
+    if (!visited(room.id)) {
+        change({ChangeType::Visit, room.id});
+        out << Colour::Bold << Colour::Cyan << room.name() << Colour::Reset
+            << "\n\n" << room.description() << "\n\n";
+    } else {
+        out << "You return to " << Colour::Bold << Colour::Cyan << room.name()
+            << Colour::Reset << ".\n\n";
+    }
+    out << Colour::Blue << "Weather: " << weatherStates[weather[game->world.roomRegion[room.id]]]
+        << Colour::Reset << "\n";
+    out << renderedRoom(room);
+}
+
+// Everything below the weather line: what lies about, the sights, who is here
+// and the ways on. It only changes when the room does, so the text is kept
+// with the version it was made from and reused while that version holds.
+std::string_view Session::renderedRoom(Room room) {
+    const uint32_t version = state.roomVersion(room.id);
+    game->npcs.in(room.id, ticks, npcsHere);
+    RenderedRoom& cached = renderedRooms[room.id & (renderedRooms.size() - 1)];
+    if (cached.room == room.id && cached.version == version && cached.npcs == npcsHere)
+        return cached.block.text();
+
+    Frame& block = cached.block; // the evicted entry's buffer is reused
+    block.ansi = out.ansi;
+    block.reset();
+    if (!room.items().empty()) {
+        block << Colour::Green << "You see:";
+        for (const ItemStack& stack : room.items()) {
+            block << ' ' << symbolText(stack.item);
+            if (stack.count > 1) block << " x" << size_t{stack.count};
+        }
+        block << Colour::Reset << "\n";
+    }
+    if (!room.pointsOfInterest().empty()) {
+        block << Colour::Yellow << "Notable:";
+        for (Symbol p : room.pointsOfInterest()) block << ' ' << symbolText(p);
+        block << Colour::Reset << "\n";
+    }
+    const Span<uint32_t> here = {npcsHere.data(), npcsHere.data() + npcsHere.size()};
+    if (!here.empty()) {
+        block << Colour::Magenta << (here.size() == 1 ? "Someone is here: " : "Others are here: ");
+        listNpcs(block, game->world, here, " and ");
+        block << Colour::Reset << "\n";
+    }
+    if (!room.exits().empty()) {
+        block << Colour::Cyan << "Exits:";
+        for (Symbol e : room.exits()) block << ' ' << symbolText(e);
+        block << Colour::Reset << "\n";
+    }
+    if (!room.actions().empty()) {
+        block << Colour::Yellow << "Actions:";
+        for (Symbol a : room.actions()) block << ' ' << symbolText(a);
+        block << Colour::Reset << "\n";
+    }
+    cached.room = room.id;
+    cached.version = version;
+    cached.npcs = npcsHere;
+    return block.text();
+}
+
+// ------------ World time ------------
+
+// One tick of world time: timers follow the player into a new region, then
+// everything that came due runs, the player's region first
+void Session::tick() {
+    const World& world = game->world;
+    ++ticks;
+    noticeNpcs();
+    if (region() != timedRegion) {
+        enterRegion(region());
+        change({ChangeType::Timer, TimerWeather, ticks + weatherDelay(rng)});
+    }
+    fired.clear();
+    timers.advance(ticks, fired);
+    for (const Timer& t : fired) {
+        switch (t.kind) {
+        case TimerWeather: {
+            weatherTimer = kNoTimer; // its id may be handed out again
+            const uint32_t states = static_cast<uint32_t>(std::size(weatherStates));
+            change({ChangeType::Weather, (weather[t.region] + 1 + rng.below(states - 1)) % states, t.region});
+            out << '\n' << Colour::Blue << "The weather shifts: " << weatherStates[weather[t.region]]
+                << "." << Colour::Reset << "\n";
+            change({ChangeType::Timer, TimerWeather, ticks + weatherDelay(rng)});
+            break;
+        }
+        case TimerEvent:
+            if (testsHold(slice(world.eventTest, world.eventTestStart, t.arg)))
+                out << '\n' << world.str(world.eventText[t.arg]) << "\n";
+            scheduleEvent(t.arg);
+            break;
+        case TimerAmbient:
+            ambientTimer = kNoTimer;
+            out << '\n' << ambientEvents[rng.below(static_cast<uint32_t>(std::size(ambientEvents)))] << "\n";
+            change({ChangeType::Timer, TimerAmbient, ticks + ambientDelay(rng)});
+            break;
+        }
+    }
+}
+
+// Tells the player who left the room or came into it on this tick
+void Session::noticeNpcs() {
+    const World& world = game->world;
+    game->npcs.in(current.id, ticks - 1, npcsBefore);
+    game->npcs.in(current.id, ticks, npcsHere);
+    npcChanges(
+        npcsBefore, npcsHere,
+        [&](uint32_t npc) {
+            out << '\n' << Colour::Magenta << "The " << symbolText(world.npcName[npc]) << " leaves."
+                << Colour::Reset << "\n";
+        },
+        [&](uint32_t npc) {
+            out << '\n' << Colour::Magenta << "The " << symbolText(world.npcName[npc]) << " arrives."
+                << Colour::Reset << "\n";
+        });
+}
+
+// Drops the timers of the region left behind and schedules the new one's
+// events. Its weather timer is up to the caller: drawn afresh on arrival,
+// or put back as saved.
+void Session::enterRegion(uint32_t region) {
+    const World& world = game->world;
+    if (timedRegion != kNoRegion) timers.cancelRegion(timedRegion);
+    weatherTimer = kNoTimer;
+    timedRegion = region;
+    for (uint32_t e = 0; e < world.eventCount(); ++e)
+        if (world.eventRegion[e] == region) scheduleEvent(e);
+}
+
+// Enters the new region before leaving the old one, so going back and forth
+// over a border never lets either go
+void Session::followRegion() {
+    const uint32_t now = region();
+    if (now == pagedRegion) return;
+    game->pager->enter(now);
+    if (pagedRegion != kNoRegion) game->pager->leave(pagedRegion);
+    pagedRegion = now;
+}
+
+// Events fire on multiples of their period, so where they stand never needs saving
+void Session::scheduleEvent(uint32_t event) {
+    const World& world = game->world;
+    const uint32_t period = world.eventPeriod[event];
+    timers.schedule({(ticks / period + 1) * period, TimerEvent, event, world.eventRegion[event]});
+}
+
+// Refills the wheel from the session's state, after a restore or a replay
+void Session::resetTimers() {
+    const World& world = game->world;
+    timers.reset(ticks);
+    timedRegion = kNoRegion;
+    enterRegion(region());
+    for (uint32_t e = 0; e < world.eventCount(); ++e)
+        if (world.eventRegion[e] == kNoRegion) scheduleEvent(e);
+    ambientTimer = ambientDue ? timers.schedule({ambientDue, TimerAmbient, 0, kNoRegion}) : kNoTimer;
+    weatherTimer = weatherDue ? timers.schedule({weatherDue, TimerWeather, 0, timedRegion}) : kNoTimer;
+}
+
+void Session::printMap() {
+    const World& world = game->world;
+    // Mark the player's room: "[Glade]" is shown as "[Glade*]"
+    const std::string_view label = current.label();
+    for (TextRef ref : world.mapLines) {
+        const std::string_view line = world.str(ref);
+        size_t pos = std::string_view::npos;
+        for (size_t at = line.find('['); !label.empty() && at != std::string_view::npos; at = line.find('[', at + 1)) {
+            if (line.compare(at + 1, label.size(), label) == 0 && line.compare(at + 1 + label.size(), 1, "]") == 0) {
+                pos = at + 1 + label.size();
+                break;
+            }
+        }
+        if (pos == std::string_view::npos) out << line << "\n";
+        else out << line.substr(0, pos) << '*' << line.substr(pos) << "\n";
+    }
+}
+
+// ------------ Conversations ------------
+
+void Session::startConversation(NPC npc) {
+    change({ChangeType::Conversation, npc.startNode()});
+    showDialogue();
+}
+
+// The current node's text and the options on offer, numbered from 1
+void Session::showDialogue() {
+    const World& world = game->world;
+    std::string_view text = world.str(world.nodeText[dialogueNode]);
+    if (!text.empty()) out << Colour::Magenta << text << Colour::Reset << "\n";
+    showDialogueOptions();
+}
+
+void Session::showDialogueOptions() {
+    const World& world = game->world;
+    size_t shown = 0;
+    for (uint32_t o = world.nodeOptionStart[dialogueNode]; o < world.nodeOptionStart[dialogueNode + 1]; ++o) {
+        if (!testsHold(slice(world.optionTest, world.optionTestStart, o))) continue;
+        out << ++shown << ". " << world.str(world.optionPrompt[o]) << "\n";
+    }
+    out << Colour::Cyan << "> " << Colour::Reset;
+}
+
+// Takes the numbered option, steps along its edge and shows where it leads
+void Session::chooseDialogueOption(std::string_view choice) {
+    const World& world = game->world;
+    // Like stoi: leading blanks, then digits, ignoring anything after them
+    size_t pos = 0, number = 0;
+    while (pos < choice.size() && (choice[pos] == ' ' || choice[pos] == '\t')) ++pos;
+    const size_t digits = pos;
+    while (pos < choice.size() && pos - digits < 9 && choice[pos] >= '0' && choice[pos] <= '9')
+        number = number * 10 + static_cast<size_t>(choice[pos++] - '0');
+
+    uint32_t chosen = kNoNode;
+    if (pos > digits && number > 0) {
+        size_t shown = 0;
+        for (uint32_t o = world.nodeOptionStart[dialogueNode]; o < world.nodeOptionStart[dialogueNode + 1]; ++o) {
+            if (testsHold(slice(world.optionTest, world.optionTestStart, o)) && ++shown == number) {
+                chosen = o;
+                break;
+            }
+        }
+    }
+    if (chosen == kNoNode) {
+        out << "He doesn't seem to understand." << "\n";
+        showDialogueOptions();
+        return;
+    }
+
+    out << world.str(world.optionResponse[chosen]) << "\n";
+    runEffects(slice(world.optionEffect, world.optionEffectStart, chosen));
+    const uint32_t next = world.optionTarget[chosen];
+    if (next == dialogueNode) {
+        showDialogueOptions();
+    } else {
+        change({ChangeType::Conversation, next});
+        if (next != kNoNode) showDialogue();
+    }
+}
+
+// ------------ Commands ------------
+
+bool Session::carrying(Symbol item) const {
+    return inventory.contains(item);
+}
+
+bool Session::command(Span<std::string_view> words) {
+    // A rule for the whole phrase comes before any verb, so a world can give
+    // "open door" or "pray" a meaning of its own
+    const Symbol phrase = findSymbol(joinWords(words, 0, scratch));
+    const uint32_t rule = findRule(phrase);
+
+    // Resolve everything the first word could mean in one lookup
+    const CommandMatch cmd = game->commands.lookup(words[0], current);
+
+    // Going back takes no checkpoint, so it can't push out the oldest one
+    if (rule == kNoRule && cmd.has(Verb::Rewind)) {
+        rewind(words);
+        return false;
+    }
+    checkpoint();
+    if (rule != kNoRule) {
+        runEffects(slice(game->world.ruleEffect, game->world.ruleEffectStart, rule));
+        return true;
+    }
+
+    if (cmd.has(Verb::Help)) {          // show available commands
+
+        out << "Available commands: look [item], go [direction], take [item], drop [item], combine [a] [b], [action], talk, travel [place], inventory, undo, rewind [n], help, exit\n";
+        out << "Type an action listed in the room to perform it." << "\n";
+        out << "Undo and rewind reach back over the last " << kCheckpoints
+            << " commands of this run, not past where a saved game was resumed." << "\n";
+
+    }
+    else if (cmd.has(Verb::Look)) {    // look around or at an item
+        if (words.size() == 1) {
+            out.clear();
+            showRoom(current);
+        } else {
+            const std::string_view item = joinWords(words, 1, scratch);
+            const Symbol itemSym = findSymbol(item);
+            if (carrying(itemSym)) {
+                std::string_view d = game->world.describeItem(itemSym);
+                if (!d.empty())
+                    out << d << "\n";
+                else
+                    out << "It's just a " << item << ".\n";
+            } else {
+                std::string_view poi = current.pointOfInterest(itemSym);
+                if (!poi.empty()) {
+                    out << poi << "\n";
+                } else {
+                    out << "You cannot see a " << item << " here." << "\n";
+                }
+            }
+        }
+    }
+    else if (cmd.has(Verb::Talk)) {   // converse with NPC
+        game->npcs.in(current.id, ticks, npcsHere);
+        const Span<uint32_t> here = {npcsHere.data(), npcsHere.data() + npcsHere.size()};
+        if (here.empty()) {
+            out << "There is no one here to talk to." << "\n";
+        } else if (words.size() >= 2) {
+            const std::string_view target = joinWords(words, 1, scratch);
+            const Symbol name = findSymbol(target);
+            const uint32_t* npc = std::find_if(here.begin(), here.end(),
+                                               [&](uint32_t n) { return game->world.npcName[n] == name; });
+            if (npc != here.end()) startConversation(NPC{&game->world, *npc});
+            else out << "There is no " << target << " here." << "\n";
+        } else if (here.size() == 1) {
+            startConversation(NPC{&game->world, here[0]});
+        } else {
+            out << "Talk to whom? ";
+            listNpcs(out, game->world, here, " or ");
+            out << "?\n";
+        }
+    }
+    else if (cmd.has(Verb::Go) && words.size() >= 2) { // move if the direction exists
+        const std::string_view dir = words[1];
+        const Symbol dirSym = findSymbol(dir);
+
+        const uint32_t exit = current.findExit(dirSym);
+        if (exit != kNoExit) {
+            if (current.exitLocked(exit)) {
+                out << "The way is locked." << "\n";
+            } else {
+                change({ChangeType::Move, current.exitTarget(exit).id});
+                out.clear();
+                showRoom(current);
+            }
+        } else {
+            out << "You can't go that way.\n";
+        }
+    }
+
+    else if (cmd.has(Verb::Travel)) {
+        travel(joinWords(words, 1, scratch));
+    }
+
+    else if (cmd.has(Verb::Take) && words.size() >= 2) { // attempt to pick up an item
+        const std::string_view item = joinWords(words, 1, scratch);
+
+        const Symbol itemSym = findSymbol(item);
+        if (current.items().contains(itemSym)) {
+            change({ChangeType::TakeItem, current.id, itemSym});
+            out << "You take the " << item << ".\n";
+        } else {
+            out << "There is no " << item << " here.\n";
+        }
+    }
+
+    else if (cmd.has(Verb::Drop) && words.size() >= 2) { // drop an item
+        const std::string_view item = joinWords(words, 1, scratch);
+
+        const Symbol itemSym = findSymbol(item);
+        if (carrying(itemSym)) {
+            change({ChangeType::DropItem, current.id, itemSym});
+            out << "You drop the " << item << ".\n";
+        } else {
+            out << "You don't have a " << item << ".\n";
+        }
+    }
+
+    else if (cmd.has(Verb::Combine)) {
+        combine(words);
+    }
+
+    else if (cmd.has(Verb::Use) && words.size() >= 2) {
+        useItemOrAction(joinWords(words, 1, scratch));
+    }
+
+    else if (cmd.action >= 0) { // action without 'use'
+        const Symbol action = current.actions()[cmd.action];
+        if (action != phrase && runRules(action)) return true; // typed with a typo
+        std::string_view result = current.actionResult(action);
+        if (!result.empty())
+            out << result << "\n";
+        else
+            out << "You " << symbolText(action) << ".\n";
+    }
+
+    else if (cmd.has(Verb::Inventory)) {     // list carried items
+        if (inventory.empty()) {
+            out << "Your inventory is empty.\n";
+        } else {
+            out << "You are carrying ";
+            bool first = true;
+            for (const ItemStack& stack : inventory) {
+                if (!first) out << ", ";
+                first = false;
+                writeCapitalized(out, symbolText(stack.item));
+                if (stack.count > 1) out << " x" << size_t{stack.count};
+            }
+            out << ".\n";
+        }
+    }
+    else if (cmd.has(Verb::Exit)) {    // leave the game
+
+        out << "Farewell, wanderer...\n";
+        done = true;
+    }
+    else {                                          // command wasn't recognized
+        out << "Unknown command. Try 'help'.\n";
+    }
+    return true;
+}
+
+// Reads "rusty key and 2 stone" into stacks, matching the longest run of
+// words that names something. Fails if any word names nothing. stacks needs
+// room for one per word.
+static bool parseIngredients(Span<std::string_view> words, ItemStack* stacks, size_t& found, Arena& arena) {
+    uint32_t count = 1;
+    found = 0;
+    for (size_t i = 1; i < words.size();) {
+        const std::string_view w = words[i];
+        if (w == "and" || w == "," || w == "+") {
+            ++i;
+            continue;
+        }
+        if (std::all_of(w.begin(), w.end(), [](char c) { return c >= '0' && c <= '9'; }) && w.size() < 6) {
+            count = 0;
+            for (char c : w) count = count * 10 + static_cast<uint32_t>(c - '0');
+            ++i;
+            continue;
+        }
+        Symbol item = kNoSymbol;
+        size_t end = words.size();
+        for (; end > i; --end) {
+            std::string_view name = joinWords(words, i, end, arena);
+            if (!name.empty() && name.back() == ',') name.remove_suffix(1);
+            item = findSymbol(name);
+            if (item != kNoSymbol) break;
+        }
+        if (item == kNoSymbol || count == 0) return false;
+        stacks[found++] = {item, count};
+        count = 1;
+        i = end;
+    }
+    return found > 0;
+}
+
+// "combine" on its own lists what can be made; "craft torch" makes a torch;
+// otherwise the words name the ingredients, in any order
+void Session::combine(Span<std::string_view> words) {
+    const World& world = game->world;
+    std::vector<uint32_t>& options = craftable;
+    if (words.size() == 1) {
+        game->recipes.craftable(inventory, options);
+        if (options.empty()) {
+            out << "Nothing you carry can be combined.\n";
+            return;
+        }
+        out << "You could craft ";
+        for (size_t i = 0; i < options.size(); ++i) {
+            if (i > 0) out << ", ";
+            out << symbolText(world.recipeOutput[options[i]]);
+        }
+        out << ".\n";
+        return;
+    }
+
+    ItemStack* inputs = scratch.allocate<ItemStack>(words.size());
+    size_t count = 0;
+    if (!parseIngredients(words, inputs, count, scratch)) {
+        out << "You lack the materials." << "\n";
+        return;
+    }
+    if (count == 1 && !carrying(inputs[0].item)) {
+        game->recipes.craftable(inventory, options);
+        for (uint32_t r : options) {
+            if (world.recipeOutput[r] == inputs[0].item) {
+                craft(r);
+                return;
+            }
+        }
+        out << "You lack the materials." << "\n";
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (inventory.count(inputs[i].item) < inputs[i].count) {
+            out << "You lack the materials." << "\n";
+            return;
+        }
+    }
+    const uint32_t recipe = game->recipes.find(inputs, count);
+    if (recipe == kNoRecipe) {
+        out << "Those items refuse to join." << "\n";
+        return;
+    }
+    craft(recipe);
+}
+
+void Session::craft(uint32_t recipe) {
+    const World& world = game->world;
+    for (uint32_t i = world.recipeInputStart[recipe]; i < world.recipeInputStart[recipe + 1]; ++i)
+        change({ChangeType::LoseItem, world.recipeInputItem[i], world.recipeInputCount[i]});
+    change({ChangeType::GainItem, world.recipeOutput[recipe], world.recipeYield[recipe]});
+    std::string_view text = world.str(world.recipeText[recipe]);
+    if (!text.empty())
+        out << text << "\n";
+    else
+        out << "You craft " << symbolText(world.recipeOutput[recipe]) << ".\n";
+}
+
+void Session::useItemOrAction(std::string_view target) {
+    const Symbol targetSym = findSymbol(target);
+    if (carrying(targetSym)) {
+        if (targetSym == SYM_MAP) {
+            printMap();
+        } else if (targetSym == SYM_STONE) {
+            out << stoneJokes[rng.below(static_cast<uint32_t>(std::size(stoneJokes)))] << "\n";
+        } else {
+            std::string_view u = game->world.useItem(targetSym);
+            if (!u.empty())
+                out << u << "\n";
+            else
+                out << "You can't think of a use for the " << target << "." << "\n";
+        }
+        return;
+    }
+
+    Span<Symbol> actions = current.actions();
+    auto it = std::find(actions.begin(), actions.end(), targetSym);
+    if (it == actions.end()) {
+        out << "You can't " << target << " here.\n";
+        return;
+    }
+    const Symbol action = *it;
+    if (runRules(action)) return;
+    std::string_view result = current.actionResult(action);
+    if (!result.empty())
+        out << result << "\n";
+    else
+        out << "You " << symbolText(action) << ".\n";
+}
+
+// Walks the shortest open route to a room seen before, all in one command
+void Session::travel(std::string_view where) {
+    const World& world = game->world;
+    if (where.empty()) {
+        out << "Travel where?\n";
+        return;
+    }
+    const RoomId target = game->routes.findRoom(world, where);
+    if (target == kNoRoom || !visited(target)) {
+        out << "You don't know the way to " << where << ".\n";
+        return;
+    }
+    if (target == current.id) {
+        out << "You are already there.\n";
+        return;
+    }
+    const std::shared_ptr<const RouteTree> tree = game->routeTrees->toward(target, world, game->routes, state);
+    const std::vector<uint32_t>& next = tree->next;
+    if (next[current.id] == kNoExit) {
+        out << "The way to " << where << " is barred.\n";
+        return;
+    }
+
+    // Long routes are summed up rather than spelled out. A step whose
+    // "go <dir>" a rule would answer is left for the player to take, as
+    // typing it would run the rule rather than move; rules test the room
+    // they are in, so the player is moved there before asking.
+    const size_t kListedSteps = 8;
+    const std::string_view go = "go";
+    size_t steps = 0;
+    RoomId at = current.id;
+    uint32_t ruled = kNoExit;
+    while (at != target) {
+        const uint32_t exit = next[at];
+        const std::string_view phrase[] = {go, symbolText(world.exitDirection[exit])};
+        const Symbol goPhrase = findSymbol(joinWords(Span<std::string_view>{phrase, phrase + 2}, 0, scratch));
+        if (!game->rules.find(at, goPhrase).empty() || !game->rules.find(kNoRoom, goPhrase).empty()) {
+            if (at != current.id) change({ChangeType::Move, at});
+            if (findRule(goPhrase) != kNoRule) {
+                ruled = exit;
+                break;
+            }
+        }
+        if (++steps == 1) {
+            out.clear();
+            out << "You travel";
+        }
+        if (steps <= kListedSteps) out << (steps > 1 ? ", " : " ") << symbolText(world.exitDirection[exit]);
+        at = world.exitTarget[exit];
+        if (at != target && !visited(at)) change({ChangeType::Visit, at}); // passed through
+    }
+    if (steps == 0) {
+        out << "The way to " << where << " leads " << symbolText(world.exitDirection[ruled])
+            << " from here; you'll have to go that way yourself.\n";
+        return;
+    }
+    if (steps > kListedSteps) out << "... " << steps << " steps in all";
+    if (ruled != kNoExit) out << ", and stop before going " << symbolText(world.exitDirection[ruled]);
+    out << ".\n\n";
+    change({ChangeType::Move, at});
+    showRoom(current);
+}
+
+// ------------ Rules ------------
+
+bool Session::runRules(Symbol trigger) {
+    const uint32_t rule = findRule(trigger);
+    if (rule == kNoRule) return false;
+    runEffects(slice(game->world.ruleEffect, game->world.ruleEffectStart, rule));
+    return true;
+}
+
+uint32_t Session::findRule(Symbol trigger) const {
+    const World& world = game->world;
+    for (RoomId scope : {current.id, kNoRoom}) {
+        for (uint32_t rule : game->rules.find(scope, trigger)) {
+            if (testsHold(slice(world.ruleTest, world.ruleTestStart, rule))) return rule;
+        }
+    }
+    return kNoRule;
+}
+
+bool Session::testsHold(Span<RuleOp> tests) const {
+    for (const RuleOp& op : tests) {
+        bool holds = false;
+        switch (op.kind) {
+        case RuleCarrying:  holds = carrying(op.arg); break;
+        case RuleLacking:   holds = !carrying(op.arg); break;
+        case RuleFlagSet:   holds = flagSet(op.arg); break;
+        case RuleFlagClear: holds = !flagSet(op.arg); break;
+        case RuleExitLocked:
+        case RuleExitOpen: {
+            const uint32_t exit = current.findExit(op.arg);
+            holds = exit != kNoExit && current.exitLocked(exit) == (op.kind == RuleExitLocked);
+            break;
+        }
+        }
+        if (!holds) return false;
+    }
+    return true;
+}
+
+void Session::runEffects(Span<RuleOp> effects) {
+    for (const RuleOp& op : effects) {
+        switch (op.kind) {
+        case RuleUnlock:
+        case RuleLock: {
+            const uint32_t exit = current.findExit(op.arg);
+            if (exit != kNoExit) change({ChangeType::LockExit, exit, op.kind == RuleLock});
+            break;
+        }
+        case RuleGive:      change({ChangeType::GainItem, op.arg, 1}); break;
+        case RuleTake:      change({ChangeType::LoseItem, op.arg, 1}); break;
+        case RuleSetFlag:   change({ChangeType::Flag, op.arg, 1}); break;
+        case RuleClearFlag: change({ChangeType::Flag, op.arg, 0}); break;
+        case RuleSay:       out << game->world.str(op.text) << "\n"; break;
+        }
+    }
+}
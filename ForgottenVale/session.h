@@ -0,0 +1,193 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.h"
+#include "commands.h"
+#include "crafting.h"
+#include "npcs.h"
+#include "paging.h"
+#include "routes.h"
+#include "rules.h"
+#include "render.h"
+#include "rng.h"
+#include "save.h"
+#include "scheduler.h"
+#include "room.h"
+#include "world.h"
+
+// Read-only data shared by every session: the world and the command, recipe,
+// rule and route indexes built from it, and where its NPCs are on any tick. The pager and the route trees are the
+// parts sessions change, telling the pager which region they are in and
+// adding trees as they travel; each does its own locking.
+struct Game {
+    World world;
+    CommandIndex commands;
+    RecipeIndex recipes;
+    RuleIndex rules;
+    RouteIndex routes;
+    NpcPlaces npcs;
+    std::unique_ptr<RegionPager> pager = std::make_unique<RegionPager>();
+    std::unique_ptr<RouteCache> routeTrees = std::make_unique<RouteCache>();
+};
+
+// Loads a world file (see worldfile.h) and prepares everything sessions need.
+// Interns every name the game uses, so call it before any session starts.
+bool loadGame(const std::string& path, Game& game, std::string& error);
+// The same for a world already in game.world, such as a generated one
+void prepareGame(Game& game);
+
+// One player's game. Everything that changes during play lives here, so a
+// process can run any number of sessions against one shared Game. Sessions
+// never block: input arrives one line at a time through handle(), and a
+// conversation is only the dialogue node the session is waiting at.
+struct Session {
+    // Every random event in the game draws from rng, so the same generator
+    // state and the same input always replay the same game. With ansi off the
+    // output carries no colours or screen clears.
+    Session(const Game& game, Rng rng, bool ansi = true);
+    ~Session();
+    // current points into state, so a session stays where it was created;
+    // fork() makes another
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    // Keeps this session's progress under path (see SaveFile), first picking
+    // up whatever was saved there. Call before start().
+    bool attachSave(const std::string& path, std::string& error);
+
+    // Welcome text, the first room and a prompt. The returned text is valid
+    // until the next call.
+    std::string_view start();
+    // Runs one line of input and returns what to show, ending with the next
+    // prompt unless the session finished. Valid until the next call.
+    std::string_view handle(std::string_view line);
+    // True once the player has quit
+    bool finished() const { return done; }
+    // Room the player is in
+    RoomId room() const { return current.id; }
+
+    // A new session carrying on from exactly where this one is, able to
+    // rewind as far as this one can, with no save file. The two share
+    // everything neither has changed, so forking costs about the same
+    // whatever the size of the world. The copy is ready for handle().
+    std::unique_ptr<Session> fork() const;
+
+    // Commands a session can rewind, at most
+    static const size_t kCheckpoints = 64;
+
+private:
+    void respond(std::string_view line);
+    void prompt();
+
+    // Every change to the session's state goes through change(), which
+    // applies it and adds it to the save journal. apply() rejects changes
+    // that don't fit the world, such as those from a damaged journal.
+    void change(const Change& c);
+    bool apply(const Change& c);
+    bool flagSet(uint32_t flag) const { return (flags[flag >> 6] >> (flag & 63)) & 1u; }
+    bool visited(RoomId room) const { return (visitedRooms[room >> 6] >> (room & 63)) & 1u; }
+    SaveState saveState() const;
+    // The same into saved, reusing what it holds
+    void saveState(SaveState& saved) const;
+    void restore(const SaveState& saved);
+    void commitChanges();
+
+    void showRoom(Room room);
+    std::string_view renderedRoom(Room room);
+
+    // World time moves on one tick per command. What happens on a tick is
+    // scheduled in a timer wheel rather than rolled for on every command:
+    // the weather of the region the player is in, that region's timed
+    // events and ambient sounds heard everywhere. Only the player's region
+    // has timers, so regions nobody is in cost nothing. NPCs walk their
+    // schedules on the same ticks, and a conversation holds time still.
+    enum TimerKind : uint32_t {
+        TimerWeather, // weather and ambient are the ids in Timer journal records
+        TimerEvent,   // arg = event
+        TimerAmbient,
+    };
+    void tick();
+    void noticeNpcs();
+    void enterRegion(uint32_t region);
+    void scheduleEvent(uint32_t event);
+    void resetTimers();
+    uint32_t region() const { return game->world.roomRegion[current.id]; }
+    // Tells the pager when the player has moved into another region
+    void followRegion();
+    void printMap();
+
+    void startConversation(NPC npc);
+    void showDialogue();
+    void showDialogueOptions();
+    void chooseDialogueOption(std::string_view choice);
+
+    // False if the command took no time, as after a rewind
+    bool command(Span<std::string_view> words);
+    // Every command outside a conversation but rewinding keeps the state from
+    // before it, and "rewind N" or "undo" goes back to one of those
+    void checkpoint();
+    void rewind(Span<std::string_view> words);
+    void combine(Span<std::string_view> words);
+    void craft(uint32_t recipe);
+    void useItemOrAction(std::string_view target);
+    void travel(std::string_view where);
+    // Runs the first rule for trigger whose tests hold; false if none did
+    bool runRules(Symbol trigger);
+    // That rule, without running it, or kNoRule
+    uint32_t findRule(Symbol trigger) const;
+    // Rule steps, shared with dialogue options
+    bool testsHold(Span<RuleOp> tests) const;
+    void runEffects(Span<RuleOp> effects);
+    bool carrying(Symbol item) const;
+
+    const Game* game;
+    WorldState state;
+    Room current;
+    ItemSet inventory;
+    VisitedRooms visitedRooms;
+    uint32_t dialogueNode = kNoNode; // where an open conversation stands
+    std::vector<uint64_t> flags;    // one bit per World::flagName
+
+    std::vector<uint32_t> weather; // per region, index into the weather states
+    uint32_t ticks = 0;
+    uint32_t ambientDue = 0, weatherDue = 0; // 0 until first armed
+    uint32_t ambientTimer = kNoTimer, weatherTimer = kNoTimer;
+    uint32_t timedRegion = kNoRegion; // region whose timers are in the wheel
+    uint32_t pagedRegion = kNoRegion; // region the pager knows the player is in
+    TimerWheel timers;
+    std::vector<Timer> fired;
+    Rng rng;
+    bool done = false;
+
+    Frame out;
+    // Words of the command being handled and anything else that only lasts
+    // as long as it; emptied after every command
+    Arena scratch;
+    std::vector<uint32_t> craftable; // kept for its capacity, see combine()
+    std::vector<uint32_t> npcsHere, npcsBefore; // likewise, see noticeNpcs()
+
+    // States from before the latest commands, oldest first from
+    // checkpoints[firstCheckpoint], all made up front (see Session())
+    std::vector<SaveState> checkpoints;
+    size_t firstCheckpoint = 0;
+    size_t checkpointCount = 0;
+
+    // Room blocks as last rendered, direct-mapped by RoomId
+    struct RenderedRoom {
+        RoomId room = kNoRoom;
+        uint32_t version = 0; // WorldState::roomVersion when rendered
+        std::vector<uint32_t> npcs; // who was there when rendered
+        Frame block;
+    };
+    std::array<RenderedRoom, 16> renderedRooms;
+
+    std::unique_ptr<SaveFile> save;
+    Rng journaledRng; // generator state as of the last journal record
+    uint32_t journaledTicks = 0;
+};
@@ -0,0 +1,1325 @@
+#include "solver.h"
+
+#include <algorithm> // std::sort, std::unique, std::find, std::any_of, std::min, std::min_element
+#include <atomic>
+#include <chrono>
+#include <cstring>   // std::memcpy, std::memcmp
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "hashing.h"
+
+static const uint32_t kNone = UINT32_MAX;
+
+// Something the player can type in a state. Moves are numbered in the order
+// Solver::expand finds them, which depends only on the state.
+enum MoveKind : uint8_t { MoveGo, MoveTake, MoveDrop, MovePickUp, MoveCraft, MoveTrigger, MoveTalk, MoveOption };
+
+struct Move {
+    MoveKind kind;
+    uint32_t arg; // exit, room stack, droppable item, recipe, trigger or dialogue option
+    RoomId at;    // the room it is typed in
+};
+
+// Rooms reached by one walk from a room, with the exit each was entered by.
+// Stamped, so it needn't be cleared between walks.
+struct Walk {
+    std::vector<uint32_t> stamp; // per room
+    std::vector<uint32_t> via;   // per room
+    std::vector<RoomId> rooms;   // in the order reached
+    uint32_t current = 0;
+
+    bool reached(RoomId r) const { return stamp[r] == current; }
+};
+
+// Each thread's walks: over the class of the state being expanded, and over
+// the class a move leads into
+static thread_local Walk expandWalk, settleWalk;
+
+// One thread's share of a level. The owner takes from the back and thieves
+// take half of what is left from the front.
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<uint32_t> states;
+
+    bool take(std::vector<uint32_t>& batch, size_t most) {
+        std::lock_guard<std::mutex> lock(mutex);
+        batch.clear();
+        while (!states.empty() && batch.size() < most) {
+            batch.push_back(states.back());
+            states.pop_back();
+        }
+        return !batch.empty();
+    }
+
+    bool stealHalf(std::vector<uint32_t>& batch) {
+        std::lock_guard<std::mutex> lock(mutex);
+        batch.clear();
+        const size_t half = (states.size() + 1) / 2;
+        for (size_t i = 0; i < half; ++i) {
+            batch.push_back(states.front());
+            states.pop_front();
+        }
+        return !batch.empty();
+    }
+};
+
+// Outside a conversation the player can walk between rooms joined both ways
+// by open exits that no rule answers going through, without changing
+// anything else; such rooms form a class. A state stands for the whole class
+// and names its lowest room, and key items lying anywhere in it have already
+// been taken, since that is never worse.
+//
+// A state is `width` bytes: the room and conversation node, one byte per
+// counted item saying how many are carried, one per stack of a counted item
+// saying how many still lie there, a pile per droppable item (the room it
+// was dropped in and how many lie there), flag bits and the bits of locks
+// that can close again. Counts stop at 255. Last, from keysAt, come the
+// bits where more is never worse: a key item is carried, or a door that
+// only ever opens is open. One state covers another if everything before
+// keysAt is the same and it has every bit the other has.
+struct Solver {
+    const Game& game;
+    const World& world;
+    const SolveOptions& options;
+
+    size_t width = 0;
+    size_t itemsAt = 8, stacksAt = 0, pilesAt = 0, flagsAt = 0, locksAt = 0, keysAt = 0;
+    std::vector<uint32_t> itemSlot;   // per Symbol, kNone unless the item is counted
+    std::vector<uint32_t> keySlot;    // per Symbol, kNone unless it is a key item
+    std::vector<uint32_t> stackStart; // per room + 1, into the stack arrays
+    std::vector<Symbol> stackItem;
+    std::vector<uint32_t> stackByte;  // per stack, kNone for a key item's, which needs none
+    std::vector<uint8_t> stackCount;  // how many lie there at the start
+    std::vector<uint32_t> inertStart; // per room + 1, into inertItem
+    std::vector<Symbol> inertItem;    // untracked items lying in each room
+    std::vector<uint32_t> lockSlot;   // per exit, kNone if nothing can close it again
+    std::vector<uint32_t> openSlot;   // per exit, a key bit for a door that only opens
+    // Per exit, an exit back that can be walked with it, or kNone if either
+    // way has a rule going through it
+    std::vector<uint32_t> backExit;
+    std::vector<uint8_t> autoTake;    // per stack, a key item no rule answers taking
+    // Whether an option tests or changes a lock, which is of the player's
+    // room. If none does, a conversation keeps its class's room instead of
+    // the one it was started in.
+    bool optionsUseRoom = false;
+    // Items a `lacking` test names, the only ones dropping can help with.
+    // Each has one pile, so once some are dropped, more can only be
+    // dropped in the same room.
+    std::vector<Symbol> droppable;
+
+    // What can be typed besides the built-in commands, and the phrases the
+    // built-ins are typed as, since a rule for the whole phrase comes first
+    std::vector<uint32_t> triggerStart; // per room + 1, into triggers
+    std::vector<Symbol> triggers;
+    std::vector<Symbol> anyRoomTriggers;
+    std::vector<Symbol> goPhrase;    // per exit
+    std::vector<Symbol> takePhrase;  // per room stack
+    std::vector<Symbol> dropPhrase;  // per droppable item
+    std::vector<Symbol> pickUpPhrase; // per droppable item, "take <item>"
+    std::vector<Symbol> craftPhrase; // per recipe
+    std::vector<uint8_t> craftable;  // per recipe, false if another has the same inputs
+    // Per recipe and droppable item, whether a rule of some room answers its
+    // phrase, so where in a class it is typed matters
+    std::vector<uint8_t> craftRuled, dropRuled;
+    Symbol talkPhrase = kNoSymbol;
+    // NPCs who can be met in each room: an NPC's home, or every stop of its
+    // schedule, since waiting long enough brings them round
+    std::vector<uint32_t> meetStart; // per room + 1, into meetNpc
+    std::vector<uint32_t> meetNpc;
+    std::vector<Symbol> talkToPhrase; // per NPC, "talk <name>"
+
+    // States are stored in chunks added as the search grows, so memory
+    // follows the states found rather than the limit
+    static constexpr size_t kChunkBits = 16;
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> bytes;
+        std::unique_ptr<uint32_t[]> depth;
+        std::unique_ptr<uint32_t[]> rank; // position within its level
+        std::unique_ptr<std::atomic<uint64_t>[]> parent;   // parent rank << 32 | move
+        std::unique_ptr<std::atomic<uint8_t>[]> winnable;  // the goal can still be reached
+        std::unique_ptr<uint32_t[]> sibling; // next in its group, or kNone
+    };
+    std::unique_ptr<std::atomic<Chunk*>[]> chunks;
+    std::vector<std::unique_ptr<Chunk>> ownedChunks;
+    // Kept states with the same bytes before keysAt, chained through
+    // Chunk::sibling. Only changed between levels.
+    std::unordered_map<uint64_t, uint32_t> groups;
+    std::mutex chunkMutex;
+    std::atomic<uint32_t> nextId{0};
+    std::atomic<bool> truncated{false};
+
+    // Open addressing, size a power of two at least twice maxStates, so it
+    // never fills. A slot holds the top of the state's hash and its id + 1.
+    std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    size_t slotMask = 0;
+
+    std::vector<std::vector<uint32_t>> levels; // state ids by depth, in rank order
+    std::unique_ptr<std::atomic<uint8_t>[]> roomReached; // per room
+    std::unique_ptr<std::atomic<uint8_t>[]> itemObtained; // per Symbol
+    // Rules and options whose tests held, counting tests on untracked items
+    // as passed; what they give is worked out once the search is done
+    std::unique_ptr<std::atomic<uint8_t>[]> ruleSeen, optionSeen;
+
+    Solver(const Game& game, const SolveOptions& options);
+
+    // ---- Storage
+    Chunk& chunk(uint32_t id) const { return *chunks[id >> kChunkBits].load(std::memory_order_acquire); }
+    static size_t within(uint32_t id) { return id & ((size_t{1} << kChunkBits) - 1); }
+    const uint8_t* bytes(uint32_t id) const { return &chunk(id).bytes[within(id) * width]; }
+    uint32_t allocate();
+    uint64_t hash(const uint8_t* s, size_t bytes) const;
+    uint64_t hash(const uint8_t* s) const { return hash(s, width); }
+    // Adds s unless an equal state is stored; returns its id either way, or
+    // kNone if the limit is reached. spare carries an unused id between calls.
+    uint32_t insert(const uint8_t* s, uint64_t h, uint32_t depth, uint64_t parent,
+                    uint32_t& spare, bool& added);
+    uint32_t find(const uint8_t* s, uint64_t h) const;
+    bool covers(const uint8_t* a, const uint8_t* b) const;
+    // A kept state covering s (a winnable one if winnable is set), or kNone
+    uint32_t cover(const uint8_t* s, bool winnable) const;
+    // Files a state that nothing kept covers, dropping what it covers from its group
+    void keep(uint32_t id);
+
+    // ---- State fields
+    static RoomId room(const uint8_t* s) { uint32_t v; std::memcpy(&v, s, 4); return v; }
+    static uint32_t node(const uint8_t* s) { uint32_t v; std::memcpy(&v, s + 4, 4); return v; }
+    static void setRoom(uint8_t* s, RoomId r) { std::memcpy(s, &r, 4); }
+    static void setNode(uint8_t* s, uint32_t n) { std::memcpy(s + 4, &n, 4); }
+    RoomId pileRoom(const uint8_t* s, uint32_t d) const { uint32_t v; std::memcpy(&v, s + pilesAt + d * 5, 4); return v; }
+    uint8_t& pileCount(uint8_t* s, uint32_t d) const { return s[pilesAt + d * 5 + 4]; }
+    uint8_t pileCount(const uint8_t* s, uint32_t d) const { return s[pilesAt + d * 5 + 4]; }
+    void setPileRoom(uint8_t* s, uint32_t d, RoomId r) const { std::memcpy(s + pilesAt + d * 5, &r, 4); }
+    uint32_t count(const uint8_t* s, Symbol item) const;
+    void give(uint8_t* s, Symbol item, uint32_t n);
+    void takeAway(uint8_t* s, Symbol item, uint32_t n);
+    bool flag(const uint8_t* s, uint32_t f) const { return (s[flagsAt + (f >> 3)] >> (f & 7)) & 1u; }
+    void setFlag(uint8_t* s, uint32_t f, bool on) const;
+    bool exitLocked(const uint8_t* s, uint32_t exit) const;
+    void setExitLocked(uint8_t* s, uint32_t exit, bool locked) const;
+    uint32_t findExit(RoomId r, Symbol direction) const { return Room{&world, nullptr, r}.findExit(direction); }
+    void mark(Symbol item) { if (item < symbolCount()) itemObtained[item].store(1, std::memory_order_relaxed); }
+
+    // ---- Classes
+    bool passable(const uint8_t* s, uint32_t e) const {
+        return backExit[e] != kNone && !exitLocked(s, e) && !exitLocked(s, backExit[e]);
+    }
+    void walk(const uint8_t* s, RoomId from, Walk& w) const;
+    // Takes the key items lying in s's class and moves to its lowest room.
+    // With said set, also writes the commands for it, walking from *at.
+    void settle(uint8_t* s, std::vector<std::string>* said, RoomId* at);
+    // Commands walking from at to another room of s's class
+    void walkTo(const uint8_t* s, RoomId& at, RoomId to, std::vector<std::string>& said) const;
+    std::vector<uint8_t> startState() const;
+
+    // ---- The game's rules, replayed on states
+    // With relaxed set, tests on untracked items pass
+    bool testsHold(const uint8_t* s, Span<RuleOp> tests, bool relaxed = false) const;
+    void runEffects(uint8_t* s, Span<RuleOp> effects);
+    bool runRules(uint8_t* s, Symbol trigger);
+    bool isTarget(const uint8_t* s) const;
+    // Calls visit(move, next, landed) for every move from s that changes
+    // the state, landed being next before settle()
+    template <typename Visit>
+    void expand(const uint8_t* s, uint8_t* next, Visit&& visit);
+    std::string moveText(const uint8_t* s, Move move) const;
+    // Commands for the index-th move out of a stored state, starting from at
+    // and leaving it where the player ends up
+    void describe(uint32_t id, uint32_t index, RoomId& at, std::vector<std::string>& said);
+    // Commands leading from the start to a state, along the search tree
+    std::vector<std::string> pathTo(uint32_t id, uint32_t depth);
+
+    // ---- Phases
+    template <typename Work>
+    void runWorkers(Work&& work);
+    void explore(unsigned worker, WorkQueue* queues, uint32_t depth, std::vector<uint32_t>& found);
+    void search();
+    void markWinnable();
+    // Items obtained through what the search left out: untracked recipe
+    // inputs and the tests on them
+    void markGifts();
+};
+
+static void addUnique(std::vector<Symbol>& set, Symbol s) {
+    if (std::find(set.begin(), set.end(), s) == set.end()) set.push_back(s);
+}
+
+Solver::Solver(const Game& game, const SolveOptions& options)
+    : game(game), world(game.world), options(options) {
+    const size_t rooms = world.roomCount();
+
+    const size_t symbols = symbolCount();
+
+    craftPhrase.resize(world.recipeCount());
+    craftable.resize(world.recipeCount());
+    for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+        std::vector<ItemStack> inputs;
+        for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1]; ++i)
+            inputs.push_back({world.recipeInputItem[i], world.recipeInputCount[i]});
+        craftable[rc] = game.recipes.find(inputs.data(), inputs.size()) == rc;
+        craftPhrase[rc] = findSymbol(moveText(nullptr, Move{MoveCraft, rc, kNoRoom}));
+    }
+    std::vector<uint32_t> optionNode(world.optionTarget.size());
+    for (uint32_t n = 0; n + 1 < world.nodeOptionStart.size(); ++n) {
+        for (uint32_t o = world.nodeOptionStart[n]; o < world.nodeOptionStart[n + 1]; ++o) optionNode[o] = n;
+    }
+
+    // Items are tracked only if they can change what is possible: goal
+    // items, items tested by a rule or option that matters, and inputs of
+    // recipes making a tracked item. A rule matters if it changes a lock,
+    // a flag or a tracked item, or answers a built-in command that would;
+    // then every rule on its trigger matters, since any of them can stand
+    // in for it. An option matters if it does the same or moves the
+    // conversation on. The rest only count towards what can be reached.
+    std::vector<uint8_t> tracked(symbols, 0);
+    for (Symbol item : options.goal) {
+        if (item < symbols) tracked[item] = 1;
+    }
+    auto starts = [](std::string_view text, std::string_view prefix) {
+        return text.substr(0, prefix.size()) == prefix;
+    };
+    auto effectsMatter = [&](Span<RuleOp> effects) {
+        for (const RuleOp& op : effects) {
+            if (op.kind == RuleGive || op.kind == RuleTake) {
+                if (tracked[op.arg]) return true;
+            } else if (op.kind != RuleSay) {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto builtIn = [&](Symbol trigger) {
+        const std::string_view text = symbolText(trigger);
+        return starts(text, "go ") || text == "talk" || starts(text, "talk ") || starts(text, "take ") ||
+               starts(text, "drop ") || starts(text, "combine ");
+    };
+    auto triggerMatters = [&](Symbol trigger) {
+        const std::string_view text = symbolText(trigger);
+        if (starts(text, "take ") || starts(text, "drop ")) {
+            const Symbol item = findSymbol(text.substr(5));
+            return item != kNoSymbol && tracked[item] != 0;
+        }
+        if (starts(text, "combine ")) {
+            for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+                if (craftPhrase[rc] == trigger && tracked[world.recipeOutput[rc]]) return true;
+            }
+            return false;
+        }
+        return builtIn(trigger);
+    };
+    for (bool grew = true; grew;) {
+        grew = false;
+        auto need = [&](Span<RuleOp> tests) {
+            for (const RuleOp& op : tests) {
+                if ((op.kind == RuleCarrying || op.kind == RuleLacking) && !tracked[op.arg]) {
+                    tracked[op.arg] = 1;
+                    grew = true;
+                }
+            }
+        };
+        std::vector<Symbol> hot; // triggers with a rule that matters
+        for (uint32_t rule = 0; rule < world.ruleCount(); ++rule) {
+            if (triggerMatters(world.ruleTrigger[rule]) ||
+                effectsMatter(slice(world.ruleEffect, world.ruleEffectStart, rule)))
+                hot.push_back(world.ruleTrigger[rule]);
+        }
+        std::sort(hot.begin(), hot.end());
+        for (uint32_t rule = 0; rule < world.ruleCount(); ++rule) {
+            if (std::binary_search(hot.begin(), hot.end(), world.ruleTrigger[rule]))
+                need(slice(world.ruleTest, world.ruleTestStart, rule));
+        }
+        for (uint32_t o = 0; o < optionNode.size(); ++o) {
+            if (world.optionTarget[o] != optionNode[o] ||
+                effectsMatter(slice(world.optionEffect, world.optionEffectStart, o)))
+                need(slice(world.optionTest, world.optionTestStart, o));
+        }
+        for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+            if (!tracked[world.recipeOutput[rc]]) continue;
+            for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1]; ++i) {
+                if (!tracked[world.recipeInputItem[i]]) {
+                    tracked[world.recipeInputItem[i]] = 1;
+                    grew = true;
+                }
+            }
+        }
+    }
+    for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+        if (!tracked[world.recipeOutput[rc]]) craftable[rc] = 0; // crafting it changes nothing
+    }
+
+    // A tracked item is a key item, where carrying one is as good as any
+    // more and carrying it is never worse than not, unless something tests
+    // for its absence, takes it away or uses it up. Key items take one bit
+    // and their stacks none: one lying in a room can be taken until one is
+    // carried. Items a `lacking` test names can be dropped.
+    std::vector<uint8_t> counted(symbols, 0);
+    for (Span<RuleOp> ops : {world.ruleTest, world.ruleEffect, world.optionTest, world.optionEffect}) {
+        for (const RuleOp& op : ops) {
+            if (op.kind == RuleLacking || op.kind == RuleTake) counted[op.arg] = 1;
+            if (op.kind == RuleLacking && tracked[op.arg]) addUnique(droppable, op.arg);
+        }
+    }
+    for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+        if (!craftable[rc]) continue;
+        for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1]; ++i)
+            counted[world.recipeInputItem[i]] = 1;
+    }
+    itemSlot.assign(symbols, kNone);
+    keySlot.assign(symbols, kNone);
+    uint32_t items = 0, keyBits = 0;
+    for (Symbol item = 0; item < symbols; ++item) {
+        if (!tracked[item]) continue;
+        if (counted[item]) itemSlot[item] = items++;
+        else keySlot[item] = keyBits++;
+    }
+
+    stackStart.assign(1, 0);
+    inertStart.assign(1, 0);
+    uint32_t stackBytes = 0;
+    for (RoomId r = 0; r < rooms; ++r) {
+        for (const ItemStack& stack : slice(world.itemPool, world.itemStart, r)) {
+            if (itemSlot[stack.item] != kNone) {
+                stackItem.push_back(stack.item);
+                stackByte.push_back(stackBytes++);
+                stackCount.push_back(static_cast<uint8_t>(std::min<uint32_t>(stack.count, 255)));
+            } else if (keySlot[stack.item] != kNone) {
+                stackItem.push_back(stack.item);
+                stackByte.push_back(kNone);
+                stackCount.push_back(0);
+            } else {
+                inertItem.push_back(stack.item);
+            }
+        }
+        stackStart.push_back(static_cast<uint32_t>(stackItem.size()));
+        inertStart.push_back(static_cast<uint32_t>(inertItem.size()));
+    }
+
+    // Exits whose lock can change: those of a rule's room in the direction
+    // it unlocks or locks, or every exit in that direction for a rule of any
+    // room or an option. A door is better open than locked if nothing can
+    // lock it again or needs it locked, and the only rules testing that it
+    // is open just talk, on a trigger whose other rules just talk or open it.
+    std::vector<RoomId> exitRoom(world.exitDirection.size());
+    for (RoomId r = 0; r < rooms; ++r) {
+        for (uint32_t e = world.exitStart[r]; e < world.exitStart[r + 1]; ++e) exitRoom[e] = r;
+    }
+    std::vector<uint8_t> changes(world.exitDirection.size(), 0), closes(world.exitDirection.size(), 0);
+    auto inScope = [&](RoomId scope, auto&& each) {
+        if (scope != kNoRoom) {
+            for (uint32_t e = world.exitStart[scope]; e < world.exitStart[scope + 1]; ++e) each(e);
+        } else {
+            for (uint32_t e = 0; e < world.exitDirection.size(); ++e) each(e);
+        }
+    };
+    auto quiet = [&](uint32_t rule, Symbol direction) {
+        for (const RuleOp& op : slice(world.ruleEffect, world.ruleEffectStart, rule)) {
+            if (op.kind != RuleSay && !(op.kind == RuleUnlock && op.arg == direction)) return false;
+        }
+        return true;
+    };
+    auto standsInForOpening = [&](uint32_t rule, Symbol direction) {
+        const Symbol trigger = world.ruleTrigger[rule];
+        if (builtIn(trigger)) return false;
+        if (world.ruleRoom[rule] != kNoRoom) {
+            for (RoomId scope : {world.ruleRoom[rule], kNoRoom}) {
+                for (uint32_t other : game.rules.find(scope, trigger)) {
+                    if (!quiet(other, direction)) return false;
+                }
+            }
+        } else {
+            for (uint32_t other = 0; other < world.ruleCount(); ++other) {
+                if (world.ruleTrigger[other] == trigger && !quiet(other, direction)) return false;
+            }
+        }
+        for (const RuleOp& op : slice(world.ruleEffect, world.ruleEffectStart, rule)) {
+            if (op.kind != RuleSay) return false;
+        }
+        return true;
+    };
+    auto scanLocks = [&](RoomId scope, Span<RuleOp> tests, Span<RuleOp> effects, uint32_t rule) {
+        for (const RuleOp& op : effects) {
+            if (op.kind != RuleUnlock && op.kind != RuleLock) continue;
+            inScope(scope, [&](uint32_t e) {
+                if (world.exitDirection[e] != op.arg) return;
+                changes[e] = 1;
+                if (op.kind == RuleLock) closes[e] = 1;
+            });
+        }
+        for (const RuleOp& op : tests) {
+            if (op.kind != RuleExitLocked && op.kind != RuleExitOpen) continue;
+            if (op.kind == RuleExitOpen && rule != kNone && standsInForOpening(rule, op.arg)) continue;
+            inScope(scope, [&](uint32_t e) {
+                if (world.exitDirection[e] == op.arg) closes[e] = 1;
+            });
+        }
+    };
+    for (uint32_t rule = 0; rule < world.ruleCount(); ++rule) {
+        scanLocks(world.ruleRoom[rule], slice(world.ruleTest, world.ruleTestStart, rule),
+                  slice(world.ruleEffect, world.ruleEffectStart, rule), rule);
+    }
+    for (uint32_t o = 0; o < optionNode.size(); ++o) {
+        scanLocks(kNoRoom, slice(world.optionTest, world.optionTestStart, o),
+                  slice(world.optionEffect, world.optionEffectStart, o), kNone);
+    }
+    for (Span<RuleOp> ops : {world.optionTest, world.optionEffect}) {
+        for (const RuleOp& op : ops) {
+            if (op.kind == RuleExitLocked || op.kind == RuleExitOpen || op.kind == RuleUnlock || op.kind == RuleLock)
+                optionsUseRoom = true;
+        }
+    }
+    uint32_t lockBits = 0;
+    lockSlot.assign(world.exitDirection.size(), kNone);
+    openSlot.assign(world.exitDirection.size(), kNone);
+    for (uint32_t e = 0; e < world.exitDirection.size(); ++e) {
+        if (!changes[e]) continue;
+        const bool locked = (world.exitLockBits[e >> 6] >> (e & 63)) & 1u;
+        if (closes[e]) lockSlot[e] = lockBits++;
+        else if (locked) openSlot[e] = keyBits++; // one open from the start stays open
+    }
+
+    stacksAt = itemsAt + items;
+    pilesAt = stacksAt + stackBytes;
+    flagsAt = pilesAt + droppable.size() * 5;
+    locksAt = flagsAt + (world.flagCount() + 7) / 8;
+    keysAt = (locksAt + (lockBits + 7) / 8 + 7) / 8 * 8;
+    width = (keysAt + (keyBits + 7) / 8 + 7) / 8 * 8;
+
+    // Rule triggers by room, and phrases for the built-in commands
+    std::vector<std::pair<RoomId, Symbol>> roomTriggers;
+    for (uint32_t rule = 0; rule < world.ruleCount(); ++rule) {
+        if (world.ruleRoom[rule] == kNoRoom) addUnique(anyRoomTriggers, world.ruleTrigger[rule]);
+        else roomTriggers.emplace_back(world.ruleRoom[rule], world.ruleTrigger[rule]);
+    }
+    std::sort(roomTriggers.begin(), roomTriggers.end());
+    roomTriggers.erase(std::unique(roomTriggers.begin(), roomTriggers.end()), roomTriggers.end());
+    triggerStart.assign(rooms + 1, 0);
+    for (const auto& entry : roomTriggers) {
+        ++triggerStart[entry.first + 1];
+        triggers.push_back(entry.second);
+    }
+    for (size_t r = 0; r < rooms; ++r) triggerStart[r + 1] += triggerStart[r];
+    for (Symbol direction : world.exitDirection)
+        goPhrase.push_back(findSymbol("go " + std::string(symbolText(direction))));
+    for (Symbol item : stackItem)
+        takePhrase.push_back(findSymbol("take " + std::string(symbolText(item))));
+    for (Symbol item : droppable) {
+        dropPhrase.push_back(findSymbol("drop " + std::string(symbolText(item))));
+        pickUpPhrase.push_back(findSymbol("take " + std::string(symbolText(item))));
+    }
+    talkPhrase = findSymbol("talk");
+    auto anyRule = [&](RoomId scope, Symbol phrase) {
+        return phrase != kNoSymbol && !game.rules.find(scope, phrase).empty();
+    };
+    auto roomRuled = [&](Symbol phrase) {
+        return std::any_of(roomTriggers.begin(), roomTriggers.end(),
+                           [&](const std::pair<RoomId, Symbol>& entry) { return entry.second == phrase; });
+    };
+    for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) craftRuled.push_back(roomRuled(craftPhrase[rc]));
+    for (Symbol phrase : dropPhrase) dropRuled.push_back(roomRuled(phrase));
+    for (RoomId r = 0; r < rooms; ++r) {
+        for (uint32_t i = stackStart[r]; i < stackStart[r + 1]; ++i)
+            autoTake.push_back(stackByte[i] == kNone && !anyRule(r, takePhrase[i]) && !anyRule(kNoRoom, takePhrase[i]));
+    }
+    backExit.assign(world.exitDirection.size(), kNone);
+    auto walkable = [&](uint32_t e) { return !anyRule(exitRoom[e], goPhrase[e]) && !anyRule(kNoRoom, goPhrase[e]); };
+    for (uint32_t e = 0; e < world.exitDirection.size(); ++e) {
+        const RoomId to = world.exitTarget[e];
+        if (!walkable(e)) continue;
+        for (uint32_t b = world.exitStart[to]; b < world.exitStart[to + 1]; ++b) {
+            if (world.exitTarget[b] == exitRoom[e] && walkable(b)) {
+                backExit[e] = b;
+                break;
+            }
+        }
+    }
+    std::vector<std::pair<RoomId, uint32_t>> meets;
+    for (uint32_t npc = 0; npc < world.npcCount(); ++npc) {
+        talkToPhrase.push_back(findSymbol("talk " + std::string(symbolText(world.npcName[npc]))));
+        if (world.npcStopStart[npc] == world.npcStopStart[npc + 1]) {
+            if (world.npcHome[npc] != kNoRoom) meets.emplace_back(world.npcHome[npc], npc);
+        }
+        for (uint32_t stop = world.npcStopStart[npc]; stop < world.npcStopStart[npc + 1]; ++stop)
+            meets.emplace_back(world.stopRoom[stop], npc);
+    }
+    std::sort(meets.begin(), meets.end());
+    meets.erase(std::unique(meets.begin(), meets.end()), meets.end());
+    meetStart.assign(rooms + 1, 0);
+    for (const auto& entry : meets) {
+        ++meetStart[entry.first + 1];
+        meetNpc.push_back(entry.second);
+    }
+    for (size_t r = 0; r < rooms; ++r) meetStart[r + 1] += meetStart[r];
+
+    size_t capacity = 16;
+    while (capacity < options.maxStates * 2) capacity *= 2;
+    slots.reset(new std::atomic<uint64_t>[capacity]());
+    slotMask = capacity - 1;
+    chunks.reset(new std::atomic<Chunk*>[(options.maxStates >> kChunkBits) + 1]());
+    roomReached.reset(new std::atomic<uint8_t>[rooms]());
+    itemObtained.reset(new std::atomic<uint8_t>[symbols]());
+    ruleSeen.reset(new std::atomic<uint8_t>[world.ruleCount()]());
+    optionSeen.reset(new std::atomic<uint8_t>[optionNode.size()]());
+}
+
+// ------------ Storage ------------
+
+uint32_t Solver::allocate() {
+    const uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    if (id >= options.maxStates) return kNone;
+    std::atomic<Chunk*>& slot = chunks[id >> kChunkBits];
+    if (!slot.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(chunkMutex);
+        if (!slot.load(std::memory_order_relaxed)) {
+            const size_t n = size_t{1} << kChunkBits;
+            auto c = std::make_unique<Chunk>();
+            c->bytes.reset(new uint8_t[n * width]);
+            c->depth.reset(new uint32_t[n]);
+            c->rank.reset(new uint32_t[n]);
+            c->parent.reset(new std::atomic<uint64_t>[n]());
+            c->winnable.reset(new std::atomic<uint8_t>[n]());
+            c->sibling.reset(new uint32_t[n]);
+            slot.store(c.get(), std::memory_order_release);
+            ownedChunks.push_back(std::move(c));
+        }
+    }
+    return id;
+}
+
+uint64_t Solver::hash(const uint8_t* s, size_t bytes) const {
+    uint64_t h = 0;
+    for (size_t i = 0; i < bytes; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, s + i, 8);
+        h = mix(h + word);
+    }
+    return h;
+}
+
+uint32_t Solver::insert(const uint8_t* s, uint64_t h, uint32_t depth, uint64_t parent,
+                        uint32_t& spare, bool& added) {
+    added = false;
+    const uint64_t tag = h >> 32;
+    for (size_t pos = h & slotMask;; pos = (pos + 1) & slotMask) {
+        uint64_t seen = slots[pos].load(std::memory_order_acquire);
+        if (seen == 0) {
+            if (spare == kNone) {
+                spare = allocate();
+                if (spare == kNone) {
+                    truncated.store(true, std::memory_order_relaxed);
+                    return kNone;
+                }
+            }
+            Chunk& c = chunk(spare);
+            std::memcpy(&c.bytes[within(spare) * width], s, width);
+            c.depth[within(spare)] = depth;
+            c.parent[within(spare)].store(parent, std::memory_order_relaxed);
+            const uint64_t mine = tag << 32 | (uint64_t{spare} + 1);
+            if (slots[pos].compare_exchange_strong(seen, mine, std::memory_order_acq_rel)) {
+                added = true;
+                const uint32_t id = spare;
+                spare = kNone;
+                return id;
+            }
+            // Another thread took the slot first; seen is now what it stored
+        }
+        if ((seen >> 32) != tag) continue;
+        const uint32_t id = static_cast<uint32_t>(seen) - 1;
+        if (std::memcmp(bytes(id), s, width) != 0) continue;
+        // Reached again within the same level: the lowest (parent, move)
+        // wins, so the tree doesn't depend on which thread got there first
+        Chunk& c = chunk(id);
+        if (c.depth[within(id)] == depth) {
+            std::atomic<uint64_t>& best = c.parent[within(id)];
+            uint64_t current = best.load(std::memory_order_relaxed);
+            while (parent < current && !best.compare_exchange_weak(current, parent, std::memory_order_relaxed)) {}
+        }
+        return id;
+    }
+}
+
+uint32_t Solver::find(const uint8_t* s, uint64_t h) const {
+    const uint64_t tag = h >> 32;
+    for (size_t pos = h & slotMask;; pos = (pos + 1) & slotMask) {
+        const uint64_t seen = slots[pos].load(std::memory_order_acquire);
+        if (seen == 0) return kNone;
+        if ((seen >> 32) != tag) continue;
+        const uint32_t id = static_cast<uint32_t>(seen) - 1;
+        if (std::memcmp(bytes(id), s, width) == 0) return id;
+    }
+}
+
+bool Solver::covers(const uint8_t* a, const uint8_t* b) const {
+    if (std::memcmp(a, b, keysAt) != 0) return false;
+    for (size_t i = keysAt; i < width; ++i) {
+        if ((a[i] & b[i]) != b[i]) return false;
+    }
+    return true;
+}
+
+uint32_t Solver::cover(const uint8_t* s, bool winnable) const {
+    auto fits = [&](uint32_t id) {
+        return !winnable || chunk(id).winnable[within(id)].load(std::memory_order_relaxed) != 0;
+    };
+    if (keysAt == width) {
+        const uint32_t id = find(s, hash(s));
+        return id != kNone && fits(id) ? id : kNone;
+    }
+    const auto group = groups.find(hash(s, keysAt));
+    if (group == groups.end()) return kNone;
+    for (uint32_t id = group->second; id != kNone; id = chunk(id).sibling[within(id)]) {
+        if (covers(bytes(id), s) && fits(id)) return id;
+    }
+    return kNone;
+}
+
+void Solver::keep(uint32_t id) {
+    if (keysAt == width) return; // find() already sees every state
+    uint32_t& head = groups.emplace(hash(bytes(id), keysAt), kNone).first->second;
+    // What the new state covers is no longer needed to cover anything else
+    uint32_t* link = &head;
+    while (*link != kNone) {
+        uint32_t& next = chunk(*link).sibling[within(*link)];
+        if (covers(bytes(id), bytes(*link))) *link = next;
+        else link = &next;
+    }
+    chunk(id).sibling[within(id)] = head;
+    head = id;
+}
+
+// ------------ State fields ------------
+
+uint32_t Solver::count(const uint8_t* s, Symbol item) const {
+    if (item >= itemSlot.size()) return 0;
+    if (itemSlot[item] != kNone) return s[itemsAt + itemSlot[item]];
+    const uint32_t bit = keySlot[item];
+    return bit == kNone ? 0 : (s[keysAt + (bit >> 3)] >> (bit & 7)) & 1u;
+}
+
+void Solver::give(uint8_t* s, Symbol item, uint32_t n) {
+    mark(item);
+    if (item >= itemSlot.size() || n == 0) return;
+    if (itemSlot[item] != kNone) {
+        const uint32_t slot = itemSlot[item];
+        s[itemsAt + slot] = static_cast<uint8_t>(std::min<uint32_t>(s[itemsAt + slot] + n, 255));
+    } else if (keySlot[item] != kNone) {
+        s[keysAt + (keySlot[item] >> 3)] |= static_cast<uint8_t>(1u << (keySlot[item] & 7));
+    }
+}
+
+// Key items are never taken away: that would have made them counted
+void Solver::takeAway(uint8_t* s, Symbol item, uint32_t n) {
+    const uint32_t slot = item < itemSlot.size() ? itemSlot[item] : kNone;
+    if (slot != kNone) s[itemsAt + slot] = static_cast<uint8_t>(s[itemsAt + slot] - std::min<uint32_t>(s[itemsAt + slot], n));
+}
+
+void Solver::setFlag(uint8_t* s, uint32_t f, bool on) const {
+    const uint8_t bit = static_cast<uint8_t>(1u << (f & 7));
+    if (on) s[flagsAt + (f >> 3)] |= bit;
+    else s[flagsAt + (f >> 3)] &= static_cast<uint8_t>(~bit);
+}
+
+bool Solver::exitLocked(const uint8_t* s, uint32_t exit) const {
+    if (const uint32_t slot = lockSlot[exit]; slot != kNone) return (s[locksAt + (slot >> 3)] >> (slot & 7)) & 1u;
+    if (const uint32_t slot = openSlot[exit]; slot != kNone) return !((s[keysAt + (slot >> 3)] >> (slot & 7)) & 1u);
+    return (world.exitLockBits[exit >> 6] >> (exit & 63)) & 1u;
+}
+
+void Solver::setExitLocked(uint8_t* s, uint32_t exit, bool locked) const {
+    if (const uint32_t slot = lockSlot[exit]; slot != kNone) {
+        const uint8_t bit = static_cast<uint8_t>(1u << (slot & 7));
+        if (locked) s[locksAt + (slot >> 3)] |= bit;
+        else s[locksAt + (slot >> 3)] &= static_cast<uint8_t>(~bit);
+    } else if (const uint32_t slot = openSlot[exit]; slot != kNone && !locked) {
+        s[keysAt + (slot >> 3)] |= static_cast<uint8_t>(1u << (slot & 7));
+    }
+}
+
+// ------------ Classes ------------
+
+void Solver::walk(const uint8_t* s, RoomId from, Walk& w) const {
+    if (w.stamp.size() < world.roomCount()) {
+        w.stamp.assign(world.roomCount(), 0);
+        w.via.resize(world.roomCount());
+        w.current = 0;
+    }
+    if (++w.current == 0) {
+        std::fill(w.stamp.begin(), w.stamp.end(), 0);
+        w.current = 1;
+    }
+    w.rooms.clear();
+    w.rooms.push_back(from);
+    w.stamp[from] = w.current;
+    w.via[from] = kNone;
+    for (size_t i = 0; i < w.rooms.size(); ++i) {
+        const RoomId r = w.rooms[i];
+        for (uint32_t e = world.exitStart[r]; e < world.exitStart[r + 1]; ++e) {
+            const RoomId to = world.exitTarget[e];
+            if (w.reached(to) || !passable(s, e)) continue;
+            w.stamp[to] = w.current;
+            w.via[to] = e;
+            w.rooms.push_back(to);
+        }
+    }
+}
+
+void Solver::settle(uint8_t* s, std::vector<std::string>* said, RoomId* at) {
+    if (node(s) != kNoNode) return;
+    static thread_local std::vector<uint8_t> tried;
+    tried.resize(width);
+    // A rule that only opens doors or hands over key items is answered
+    // straight away too, which can widen the class, until nothing changes.
+    // The commands pick things up nearest first.
+    Walk& w = settleWalk;
+    auto answer = [&](RoomId r, Symbol trigger) {
+        std::memcpy(tried.data(), s, width);
+        setRoom(tried.data(), r);
+        if (!runRules(tried.data(), trigger)) return false;
+        setRoom(tried.data(), room(s));
+        if (std::memcmp(tried.data(), s, width) == 0 || !covers(tried.data(), s)) return false;
+        if (said) {
+            walkTo(s, *at, r, *said);
+            said->push_back(std::string(symbolText(trigger)));
+        }
+        std::memcpy(s + keysAt, tried.data() + keysAt, width - keysAt);
+        return true;
+    };
+    for (bool grew = true; grew;) {
+        grew = false;
+        walk(s, said ? *at : room(s), w);
+        for (RoomId r : w.rooms) {
+            for (uint32_t i = stackStart[r]; i < stackStart[r + 1]; ++i) {
+                if (!autoTake[i] || count(s, stackItem[i]) > 0) continue;
+                if (said) {
+                    walkTo(s, *at, r, *said);
+                    said->push_back("take " + std::string(symbolText(stackItem[i])));
+                }
+                give(s, stackItem[i], 1);
+            }
+            if (keysAt == width) continue;
+            const Symbol* own = triggers.data() + triggerStart[r];
+            const Symbol* ownEnd = triggers.data() + triggerStart[r + 1];
+            for (const Symbol* t = own; t != ownEnd; ++t) grew |= answer(r, *t);
+            for (Symbol trigger : anyRoomTriggers) {
+                if (std::find(own, ownEnd, trigger) == ownEnd) grew |= answer(r, trigger);
+            }
+        }
+    }
+    setRoom(s, *std::min_element(w.rooms.begin(), w.rooms.end()));
+}
+
+// Walks back from `to` along the exits that reached each room on the way out
+void Solver::walkTo(const uint8_t* s, RoomId& at, RoomId to, std::vector<std::string>& said) const {
+    Walk w;
+    walk(s, to, w);
+    if (!w.reached(at)) return;
+    for (RoomId r = at; r != to;) {
+        const uint32_t e = backExit[w.via[r]];
+        said.push_back("go " + std::string(symbolText(world.exitDirection[e])));
+        r = world.exitTarget[e];
+    }
+    at = to;
+}
+
+std::vector<uint8_t> Solver::startState() const {
+    std::vector<uint8_t> start(width, 0);
+    setRoom(start.data(), world.startRoom);
+    setNode(start.data(), kNoNode);
+    for (size_t i = 0; i < stackItem.size(); ++i) {
+        if (stackByte[i] != kNone) start[stacksAt + stackByte[i]] = stackCount[i];
+    }
+    for (uint32_t d = 0; d < droppable.size(); ++d) setPileRoom(start.data(), d, kNoRoom);
+    for (uint32_t e = 0; e < lockSlot.size(); ++e) {
+        if (lockSlot[e] != kNone) setExitLocked(start.data(), e, (world.exitLockBits[e >> 6] >> (e & 63)) & 1u);
+    }
+    return start;
+}
+
+// ------------ Game rules ------------
+
+// Mirrors Session::testsHold
+bool Solver::testsHold(const uint8_t* s, Span<RuleOp> tests, bool relaxed) const {
+    for (const RuleOp& op : tests) {
+        bool holds = false;
+        switch (op.kind) {
+        case RuleCarrying:
+            holds = count(s, op.arg) > 0 ||
+                    (relaxed && itemSlot[op.arg] == kNone && keySlot[op.arg] == kNone);
+            break;
+        case RuleLacking:   holds = count(s, op.arg) == 0; break;
+        case RuleFlagSet:   holds = flag(s, op.arg); break;
+        case RuleFlagClear: holds = !flag(s, op.arg); break;
+        case RuleExitLocked:
+        case RuleExitOpen: {
+            const uint32_t exit = findExit(room(s), op.arg);
+            holds = exit != kNoExit && exitLocked(s, exit) == (op.kind == RuleExitLocked);
+            break;
+        }
+        }
+        if (!holds) return false;
+    }
+    return true;
+}
+
+// Mirrors Session::runEffects
+void Solver::runEffects(uint8_t* s, Span<RuleOp> effects) {
+    for (const RuleOp& op : effects) {
+        switch (op.kind) {
+        case RuleUnlock:
+        case RuleLock: {
+            const uint32_t exit = findExit(room(s), op.arg);
+            if (exit != kNoExit) setExitLocked(s, exit, op.kind == RuleLock);
+            break;
+        }
+        case RuleGive:      give(s, op.arg, 1); break;
+        case RuleTake:      takeAway(s, op.arg, 1); break;
+        case RuleSetFlag:   setFlag(s, op.arg, true); break;
+        case RuleClearFlag: setFlag(s, op.arg, false); break;
+        }
+    }
+}
+
+// Mirrors Session::runRules
+bool Solver::runRules(uint8_t* s, Symbol trigger) {
+    if (trigger == kNoSymbol) return false;
+    for (RoomId scope : {room(s), kNoRoom}) {
+        for (uint32_t rule : game.rules.find(scope, trigger)) {
+            const Span<RuleOp> tests = slice(world.ruleTest, world.ruleTestStart, rule);
+            if (!ruleSeen[rule].load(std::memory_order_relaxed) && testsHold(s, tests, true))
+                ruleSeen[rule].store(1, std::memory_order_relaxed);
+            if (!testsHold(s, tests)) continue;
+            runEffects(s, slice(world.ruleEffect, world.ruleEffectStart, rule));
+            return true;
+        }
+    }
+    return false;
+}
+
+// Carrying every goal item; without a goal, simply not stuck talking
+bool Solver::isTarget(const uint8_t* s) const {
+    if (options.goal.empty()) return node(s) == kNoNode;
+    for (Symbol item : options.goal) {
+        if (count(s, item) == 0) return false;
+    }
+    return true;
+}
+
+template <typename Visit>
+void Solver::expand(const uint8_t* s, uint8_t* next, Visit&& visit) {
+    static thread_local std::vector<uint8_t> scratch;
+    scratch.resize(2 * width);
+    uint8_t* here = scratch.data();         // s, standing in the room being tried
+    uint8_t* landed = here + width;
+    std::memcpy(here, s, width);
+    auto fresh = [&] { std::memcpy(next, here, width); };
+    // A conversation in the class's room ending with nothing else changed
+    // needs no settling
+    const bool settled = node(s) == kNoNode || !optionsUseRoom;
+    auto emit = [&](Move move) {
+        if (std::memcmp(next, here, width) == 0) return;
+        std::memcpy(landed, next, width);
+        if (!settled || room(next) != room(here) || std::memcmp(next + 8, here + 8, width - 8) != 0)
+            settle(next, nullptr, nullptr);
+        if (std::memcmp(next, s, width) != 0) visit(move, next, landed);
+    };
+
+    // In a conversation every line picks an option
+    const uint32_t at = node(s);
+    if (at != kNoNode) {
+        roomReached[room(s)].store(1, std::memory_order_relaxed);
+        for (uint32_t o = world.nodeOptionStart[at]; o < world.nodeOptionStart[at + 1]; ++o) {
+            const Span<RuleOp> tests = slice(world.optionTest, world.optionTestStart, o);
+            if (!optionSeen[o].load(std::memory_order_relaxed) && testsHold(s, tests, true))
+                optionSeen[o].store(1, std::memory_order_relaxed);
+            if (!testsHold(s, tests)) continue;
+            fresh();
+            runEffects(next, slice(world.optionEffect, world.optionEffectStart, o));
+            setNode(next, world.optionTarget[o]);
+            emit({MoveOption, o, room(s)});
+        }
+        return;
+    }
+
+    // Every room of the class, starting with the state's own
+    Walk& w = expandWalk;
+    walk(s, room(s), w);
+    auto ruled = [&](Symbol phrase) {
+        fresh();
+        return runRules(next, phrase);
+    };
+    for (RoomId r : w.rooms) {
+        roomReached[r].store(1, std::memory_order_relaxed);
+        for (uint32_t i = inertStart[r]; i < inertStart[r + 1]; ++i) mark(inertItem[i]);
+        setRoom(here, r);
+        const bool first = r == room(s);
+
+        // Built-in commands, unless a rule for the whole phrase takes over
+        for (uint32_t e = world.exitStart[r]; e < world.exitStart[r + 1]; ++e) {
+            if (!ruled(goPhrase[e])) {
+                if (exitLocked(here, e) || w.reached(world.exitTarget[e])) continue;
+                setRoom(next, world.exitTarget[e]);
+            }
+            emit({MoveGo, e, r});
+        }
+        for (uint32_t i = stackStart[r]; i < stackStart[r + 1]; ++i) {
+            const uint32_t byte = stackByte[i];
+            if (byte == kNone ? count(here, stackItem[i]) > 0 : here[stacksAt + byte] == 0) continue;
+            if (!ruled(takePhrase[i])) {
+                if (byte != kNone) --next[stacksAt + byte];
+                give(next, stackItem[i], 1);
+            }
+            emit({MoveTake, i, r});
+        }
+        // Where in the class an item is dropped only matters to a rule there
+        for (uint32_t d = 0; d < droppable.size(); ++d) {
+            const Symbol item = droppable[d];
+            const bool lying = pileRoom(here, d) == r;
+            if ((first || dropRuled[d]) && count(here, item) > 0 && (lying || pileCount(here, d) == 0)) {
+                if (!ruled(dropPhrase[d])) {
+                    takeAway(next, item, 1);
+                    setPileRoom(next, d, r);
+                    ++pileCount(next, d);
+                }
+                emit({MoveDrop, d, r});
+            }
+            if (lying && pileCount(here, d) > 0) {
+                if (!ruled(pickUpPhrase[d])) {
+                    if (--pileCount(next, d) == 0) setPileRoom(next, d, kNoRoom);
+                    give(next, item, 1);
+                }
+                emit({MovePickUp, d, r});
+            }
+        }
+        for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+            if (!craftable[rc] || !(first || craftRuled[rc])) continue;
+            bool enough = true;
+            for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1] && enough; ++i)
+                enough = count(here, world.recipeInputItem[i]) >= world.recipeInputCount[i];
+            if (!enough) continue;
+            if (!ruled(craftPhrase[rc])) {
+                for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1]; ++i)
+                    takeAway(next, world.recipeInputItem[i], world.recipeInputCount[i]);
+                give(next, world.recipeOutput[rc], world.recipeYield[rc]);
+            }
+            emit({MoveCraft, rc, r});
+        }
+        const bool alone = meetStart[r + 1] - meetStart[r] == 1;
+        for (uint32_t m = meetStart[r]; m < meetStart[r + 1]; ++m) {
+            const uint32_t npc = meetNpc[m];
+            if (!ruled(alone ? talkPhrase : talkToPhrase[npc])) {
+                setNode(next, world.npcStartNode[npc]);
+                if (!optionsUseRoom) setRoom(next, room(s));
+            }
+            emit({MoveTalk, npc, r});
+        }
+
+        // Anything else only matters if a rule answers it
+        for (uint32_t t = triggerStart[r]; t < triggerStart[r + 1]; ++t) {
+            if (ruled(triggers[t])) emit({MoveTrigger, triggers[t], r});
+        }
+        const Symbol* tried = triggers.data() + triggerStart[r];
+        const Symbol* triedEnd = triggers.data() + triggerStart[r + 1];
+        for (Symbol trigger : anyRoomTriggers) {
+            if (std::find(tried, triedEnd, trigger) != triedEnd) continue;
+            if (ruled(trigger)) emit({MoveTrigger, trigger, r});
+        }
+    }
+}
+
+// The line a player would type; s is only needed to number dialogue options
+std::string Solver::moveText(const uint8_t* s, Move move) const {
+    switch (move.kind) {
+    case MoveGo:
+        return "go " + std::string(symbolText(world.exitDirection[move.arg]));
+    case MoveTake:
+        return "take " + std::string(symbolText(stackItem[move.arg]));
+    case MoveDrop:
+        return "drop " + std::string(symbolText(droppable[move.arg]));
+    case MovePickUp:
+        return "take " + std::string(symbolText(droppable[move.arg]));
+    case MoveCraft: {
+        std::string text = "combine";
+        for (uint32_t i = world.recipeInputStart[move.arg]; i < world.recipeInputStart[move.arg + 1]; ++i) {
+            if (i > world.recipeInputStart[move.arg]) text += " and";
+            if (world.recipeInputCount[i] > 1) text += ' ' + std::to_string(world.recipeInputCount[i]);
+            text += ' ';
+            text += symbolText(world.recipeInputItem[i]);
+        }
+        return text;
+    }
+    case MoveTrigger:
+        return std::string(symbolText(move.arg));
+    case MoveTalk: {
+        const RoomId r = move.at;
+        if (meetStart[r + 1] - meetStart[r] == 1) return "talk";
+        return "talk " + std::string(symbolText(world.npcName[move.arg]));
+    }
+    case MoveOption: {
+        size_t shown = 0;
+        for (uint32_t o = world.nodeOptionStart[node(s)]; o <= move.arg; ++o) {
+            if (testsHold(s, slice(world.optionTest, world.optionTestStart, o))) ++shown;
+        }
+        return std::to_string(shown);
+    }
+    }
+    return {};
+}
+
+void Solver::describe(uint32_t id, uint32_t index, RoomId& at, std::vector<std::string>& said) {
+    const uint8_t* s = bytes(id);
+    std::vector<uint8_t> next(width), after(width);
+    uint32_t k = 0;
+    expand(s, next.data(), [&](Move move, const uint8_t*, const uint8_t* landed) {
+        if (k++ != index) return;
+        std::memcpy(after.data(), landed, width);
+        if (node(s) == kNoNode) {
+            walkTo(s, at, move.at, said);
+            at = move.kind == MoveGo ? room(landed) : move.at;
+        }
+        said.push_back(moveText(s, move));
+    });
+    // Settled outside expand(), which is still walking s's class while it visits
+    settle(after.data(), &said, &at);
+}
+
+// ------------ Search ------------
+
+template <typename Work>
+void Solver::runWorkers(Work&& work) {
+    std::vector<std::thread> threads;
+    for (unsigned w = 1; w < options.workers; ++w) threads.emplace_back(work, w);
+    work(0u);
+    for (std::thread& t : threads) t.join();
+}
+
+void Solver::explore(unsigned worker, WorkQueue* queues, uint32_t depth, std::vector<uint32_t>& found) {
+    std::vector<uint32_t> batch;
+    std::vector<uint8_t> next(width);
+    uint32_t spare = kNone;
+    auto steal = [&] {
+        for (unsigned i = 1; i < options.workers; ++i) {
+            if (queues[(worker + i) % options.workers].stealHalf(batch)) return true;
+        }
+        return false;
+    };
+    // Nothing joins a level while it runs, so once every queue is empty the
+    // level is done
+    while (queues[worker].take(batch, 64) || steal()) {
+        for (uint32_t id : batch) {
+            const uint64_t parentRank = uint64_t{chunk(id).rank[within(id)]} << 32;
+            uint32_t k = 0;
+            expand(bytes(id), next.data(), [&](Move, const uint8_t* n, const uint8_t*) {
+                const uint64_t parent = parentRank | k++;
+                if (keysAt != width && cover(n, false) != kNone) return; // no better than one kept
+                bool added = false;
+                const uint32_t child = insert(n, hash(n), depth + 1, parent, spare, added);
+                if (added) found.push_back(child);
+            });
+        }
+    }
+}
+
+void Solver::search() {
+    std::vector<uint8_t> start = startState();
+    settle(start.data(), nullptr, nullptr);
+    uint32_t spare = kNone;
+    bool added = false;
+    const uint32_t first = insert(start.data(), hash(start.data()), 0, 0, spare, added);
+    if (first == kNone) return;
+    chunk(first).rank[within(first)] = 0;
+    keep(first);
+    levels.push_back({first});
+
+    std::unique_ptr<WorkQueue[]> queues(new WorkQueue[options.workers]);
+    std::vector<std::vector<uint32_t>> found(options.workers);
+    for (uint32_t depth = 0;; ++depth) {
+        // Hand each thread a contiguous block; imbalance is evened out by stealing
+        const std::vector<uint32_t>& level = levels.back();
+        for (unsigned w = 0; w < options.workers; ++w) {
+            const size_t begin = level.size() * w / options.workers;
+            const size_t end = level.size() * (w + 1) / options.workers;
+            queues[w].states.assign(level.begin() + begin, level.begin() + end);
+            found[w].clear();
+        }
+        runWorkers([&](unsigned w) { explore(w, queues.get(), depth, found[w]); });
+
+        std::vector<uint32_t> next;
+        for (const std::vector<uint32_t>& f : found) next.insert(next.end(), f.begin(), f.end());
+        if (next.empty()) break;
+        std::vector<std::pair<uint64_t, uint32_t>> keyed;
+        keyed.reserve(next.size());
+        for (uint32_t id : next) keyed.emplace_back(chunk(id).parent[within(id)].load(std::memory_order_relaxed), id);
+        std::sort(keyed.begin(), keyed.end());
+        // In that order, a state another kept one covers is dropped, even
+        // one from this level
+        next.clear();
+        for (const auto& entry : keyed) {
+            const uint32_t id = entry.second;
+            if (keysAt != width && cover(bytes(id), false) != kNone) continue;
+            keep(id);
+            chunk(id).rank[within(id)] = static_cast<uint32_t>(next.size());
+            next.push_back(id);
+        }
+        levels.push_back(std::move(next));
+    }
+}
+
+std::vector<std::string> Solver::pathTo(uint32_t id, uint32_t depth) {
+    std::vector<std::pair<uint32_t, uint32_t>> moves; // state and move index, from the start
+    for (; depth > 0; --depth) {
+        const uint64_t parent = chunk(id).parent[within(id)].load(std::memory_order_relaxed);
+        const uint32_t from = levels[depth - 1][parent >> 32];
+        moves.emplace_back(from, static_cast<uint32_t>(parent));
+        id = from;
+    }
+    std::reverse(moves.begin(), moves.end());
+    std::vector<std::string> path;
+    RoomId at = world.startRoom;
+    std::vector<uint8_t> start = startState();
+    settle(start.data(), &path, &at);
+    for (const auto& move : moves) describe(move.first, move.second, at, path);
+    return path;
+}
+
+// A state is winnable if it is a target or any move leads to a winnable
+// state, or to one covered by a winnable state. Marks spread backwards, so
+// states are visited deepest first and passes repeat until nothing new is
+// marked; marked states are never looked at again, and a state stops at the
+// first winnable successor it finds.
+void Solver::markWinnable() {
+    std::vector<uint32_t> order;
+    for (size_t d = levels.size(); d-- > 0;) order.insert(order.end(), levels[d].begin(), levels[d].end());
+    for (uint32_t id : order)
+        chunk(id).winnable[within(id)].store(isTarget(bytes(id)), std::memory_order_relaxed);
+
+    std::atomic<bool> changed{true};
+    while (changed.load()) {
+        changed = false;
+        std::atomic<size_t> cursor{0};
+        runWorkers([&](unsigned) {
+            std::vector<uint8_t> next(width);
+            for (size_t begin; (begin = cursor.fetch_add(256)) < order.size();) {
+                for (size_t i = begin; i < std::min(begin + 256, order.size()); ++i) {
+                    std::atomic<uint8_t>& winnable = chunk(order[i]).winnable[within(order[i])];
+                    if (winnable.load(std::memory_order_relaxed)) continue;
+                    bool found = false;
+                    expand(bytes(order[i]), next.data(), [&](Move, const uint8_t* n, const uint8_t*) {
+                        if (!found) found = cover(n, true) != kNone;
+                    });
+                    if (!found) continue;
+                    winnable.store(1, std::memory_order_relaxed);
+                    changed.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+}
+
+void Solver::markGifts() {
+    auto obtained = [&](Symbol item) { return itemObtained[item].load(std::memory_order_relaxed) != 0; };
+    auto testsMet = [&](Span<RuleOp> tests) {
+        for (const RuleOp& op : tests) {
+            if (op.kind == RuleCarrying && itemSlot[op.arg] == kNone && keySlot[op.arg] == kNone && !obtained(op.arg))
+                return false;
+        }
+        return true;
+    };
+    for (bool grew = true; grew;) {
+        grew = false;
+        auto gain = [&](Symbol item) {
+            if (obtained(item)) return;
+            mark(item);
+            grew = true;
+        };
+        for (uint32_t rule = 0; rule < world.ruleCount(); ++rule) {
+            if (!ruleSeen[rule].load(std::memory_order_relaxed) ||
+                !testsMet(slice(world.ruleTest, world.ruleTestStart, rule)))
+                continue;
+            for (const RuleOp& op : slice(world.ruleEffect, world.ruleEffectStart, rule)) {
+                if (op.kind == RuleGive) gain(op.arg);
+            }
+        }
+        for (uint32_t o = 0; o < world.optionTarget.size(); ++o) {
+            if (!optionSeen[o].load(std::memory_order_relaxed) ||
+                !testsMet(slice(world.optionTest, world.optionTestStart, o)))
+                continue;
+            for (const RuleOp& op : slice(world.optionEffect, world.optionEffectStart, o)) {
+                if (op.kind == RuleGive) gain(op.arg);
+            }
+        }
+        for (uint32_t rc = 0; rc < world.recipeCount(); ++rc) {
+            bool all = true;
+            for (uint32_t i = world.recipeInputStart[rc]; i < world.recipeInputStart[rc + 1] && all; ++i)
+                all = obtained(world.recipeInputItem[i]);
+            if (all) gain(world.recipeOutput[rc]);
+        }
+    }
+}
+
+SolveReport solveWorld(const Game& game, const SolveOptions& requested) {
+    const auto began = std::chrono::steady_clock::now();
+    SolveOptions options = requested;
+    if (options.workers == 0) options.workers = 1;
+    options.maxStates = std::min<size_t>(std::max<size_t>(options.maxStates, 1), size_t{1} << 31);
+
+    Solver solver(game, options);
+    const World& world = game.world;
+    SolveReport report;
+    solver.search();
+    report.complete = !solver.truncated.load();
+    if (report.complete) solver.markWinnable();
+
+    report.levels = solver.levels.size();
+    for (const std::vector<uint32_t>& level : solver.levels) report.states += level.size();
+
+    // What was never reached only means something once every state has been seen
+    if (report.complete) {
+        solver.markGifts();
+        for (RoomId r = 0; r < world.roomCount(); ++r) {
+            if (!solver.roomReached[r].load()) report.unreachableRooms.push_back(r);
+        }
+        std::vector<Symbol> items;
+        for (const ItemStack& stack : world.itemPool) items.push_back(stack.item);
+        items.insert(items.end(), world.recipeOutput.begin(), world.recipeOutput.end());
+        for (Span<RuleOp> effects : {world.ruleEffect, world.optionEffect}) {
+            for (const RuleOp& op : effects) {
+                if (op.kind == RuleGive) items.push_back(op.arg);
+            }
+        }
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+        for (Symbol item : items) {
+            if (!solver.itemObtained[item].load()) report.unreachableItems.push_back(item);
+        }
+    }
+
+    auto winnable = [&](uint32_t id) {
+        return solver.chunk(id).winnable[Solver::within(id)].load(std::memory_order_relaxed) != 0;
+    };
+
+    // Levels are in a fixed order, so the first state found is always the same one
+    uint32_t trapped = kNone, trappedDepth = 0;
+    uint32_t won = kNone, wonDepth = 0;
+    for (uint32_t d = 0; d < solver.levels.size(); ++d) {
+        for (uint32_t id : solver.levels[d]) {
+            if (won == kNone && solver.isTarget(solver.bytes(id))) {
+                won = id;
+                wonDepth = d;
+            }
+            // Softlocks only mean something once every state has been seen
+            if (!report.complete || winnable(id)) continue;
+            if (report.softlocks++ == 0) {
+                trapped = id;
+                trappedDepth = d;
+            }
+        }
+    }
+    if (trapped != kNone) report.softlockPath = solver.pathTo(trapped, trappedDepth);
+    report.winnable = won != kNone;
+    if (won != kNone) report.winningPath = solver.pathTo(won, wonDepth);
+
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+    return report;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "session.h"
+
+struct SolveOptions {
+    // Items the player must end up carrying. Without any, the solver only
+    // checks that every room and item can be reached and that no
+    // conversation can trap the player.
+    std::vector<Symbol> goal;
+    unsigned workers = 1;
+    // The search stops growing past this many states; the state table is
+    // sized for it up front, at 16 bytes a state
+    size_t maxStates = size_t{1} << 22;
+};
+
+struct SolveReport {
+    size_t states = 0;
+    size_t levels = 0;      // moves in the longest shortest path, plus one; walking is free
+    bool complete = true;   // false if maxStates cut the search short
+    std::vector<RoomId> unreachableRooms;
+    std::vector<Symbol> unreachableItems; // placed, crafted or given, never obtained
+    // Reachable states from which the goal can no longer be reached (or,
+    // without a goal, the player can no longer leave a conversation), and
+    // the shortest commands leading into one of them
+    size_t softlocks = 0;
+    std::vector<std::string> softlockPath;
+    bool winnable = false;
+    // Fewest moves that change more than where the player stands, with the
+    // walking between them filled in; one typed line each
+    std::vector<std::string> winningPath;
+    double seconds = 0;
+};
+
+// Proves a world can be finished by exploring every abstract state a game
+// can reach: the room, the conversation node, what is carried, what is
+// still lying in rooms, the flags and the lock of every exit a rule or
+// conversation can change. Dropping an item only matters to a `lacking`
+// test, so only items such a test names are ever dropped. Weather and timed
+// or random events never change what is possible, so they are left out, and
+// so is the time of day: an NPC on a schedule can be talked to at any of its
+// stops, since waiting there brings them round. Items that no test, recipe
+// or effect looks at are left out too; they only count towards what can be
+// reached, worked out from which rules and options the search saw.
+//
+// Most of what is left can only help. Key items, which nothing tests the
+// absence of, takes away or uses up, are one bit each, as are doors that
+// only ever open. Rooms joined both ways by open exits that no rule answers
+// going through are walked between for free, so a state stands for all of
+// them; key items lying there are taken, and rules that only open doors or
+// give key items are answered, as soon as a state is reached. A state with
+// every bit of another that is otherwise the same covers it, and a covered
+// state is never explored.
+//
+// The search is a breadth-first walk run level by level on `workers`
+// threads. Each thread keeps its share of the level in a queue and steals
+// from the others once it runs dry, and new states are deduplicated in a
+// shared lock-free hash table. States of each level are ordered by how they
+// were reached before the next level starts, so the report is the same
+// whatever the thread count.
+SolveReport solveWorld(const Game& game, const SolveOptions& options);
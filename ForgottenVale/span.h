@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Read-only view of a contiguous run of elements
+template <typename T>
+struct Span {
+    const T* first = nullptr;
+    const T* last = nullptr;
+
+    const T* begin() const { return first; }
+    const T* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+    const T& operator[](size_t i) const { return first[i]; }
+};
+
+// The slice of a CSR pool owned by owner: [start[owner], start[owner + 1])
+template <typename T>
+Span<T> slice(Span<T> pool, Span<uint32_t> start, uint32_t owner) {
+    return {pool.first + start[owner], pool.first + start[owner + 1]};
+}
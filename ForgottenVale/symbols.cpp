@@ -0,0 +1,61 @@
+#include "symbols.h"
+
+#include <deque>         // stable storage so views into names stay valid
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct SymbolTable {
+    std::vector<std::string_view> names;              // indexed by Symbol
+    std::deque<std::string> owned;                    // names interned at runtime
+    std::unordered_map<std::string_view, Symbol> ids; // views into names
+};
+
+// Function-local so symbols can be interned during static initialisation
+static SymbolTable& table() {
+    static SymbolTable t;
+    return t;
+}
+
+Symbol intern(std::string_view text) {
+    SymbolTable& t = table();
+    auto it = t.ids.find(text);
+    if (it != t.ids.end()) return it->second;
+    const Symbol id = static_cast<Symbol>(t.names.size());
+    t.owned.emplace_back(text);
+    t.names.push_back(t.owned.back());
+    t.ids.emplace(t.names.back(), id);
+    return id;
+}
+
+Symbol findSymbol(std::string_view text) {
+    const SymbolTable& t = table();
+    auto it = t.ids.find(text);
+    return it != t.ids.end() ? it->second : kNoSymbol;
+}
+
+std::string_view symbolText(Symbol symbol) {
+    return table().names[symbol];
+}
+
+size_t symbolCount() {
+    return table().names.size();
+}
+
+bool adoptSymbols(const char* chars, const uint32_t* offsets, size_t count) {
+    SymbolTable& t = table();
+    t.ids.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string_view name(chars + offsets[i], offsets[i + 1] - offsets[i]);
+        auto it = t.ids.find(name);
+        if (it != t.ids.end()) {
+            // Already known, e.g. the image was built by this process
+            if (it->second != i) return false;
+            continue;
+        }
+        if (t.names.size() != i) return false;
+        t.names.push_back(name);
+        t.ids.emplace(name, static_cast<Symbol>(i));
+    }
+    return true;
+}
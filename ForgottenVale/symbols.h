@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Compact ID for a name used by the game world: items, exit directions,
+// actions, points of interest and NPCs. Every name is interned once while the
+// world is loaded; after that the game compares and hashes integers and only
+// turns a symbol back into text when printing it.
+//
+// The table is not locked. Intern everything before sessions start; from then
+// on findSymbol and symbolText only read it and are safe from any thread.
+using Symbol = uint32_t;
+
+constexpr Symbol kNoSymbol = UINT32_MAX;
+
+// Returns the symbol for text, adding it to the table the first time
+Symbol intern(std::string_view text);
+
+// Returns the symbol for text if it has been interned, otherwise kNoSymbol.
+// Used for player input so unknown words never grow the table.
+Symbol findSymbol(std::string_view text);
+
+// The text a symbol was interned from
+std::string_view symbolText(Symbol symbol);
+
+// Number of symbols interned so far; every Symbol is below this
+size_t symbolCount();
+
+// Registers the names stored in a world image as symbols 0..count-1. Name i
+// spans chars[offsets[i]] to chars[offsets[i + 1]]. The names are referenced
+// in place, so the image must outlive every use of the symbol table. Fails if
+// one of the names is already interned under a different ID.
+bool adoptSymbols(const char* chars, const uint32_t* offsets, size_t count);
@@ -0,0 +1,249 @@
+#include "text.h"
+
+#include <algorithm> // std::sort, std::min
+#include <cstring>   // std::memcpy
+#include <string>
+#include <unordered_map>
+
+constexpr size_t kShortCodes = 0xf0 - 0x80;
+constexpr size_t kLongCodes = (0xff - 0xf0) * 256;
+
+static bool isLetter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Length of the run of letters starting at i
+static size_t letters(std::string_view s, size_t i) {
+    size_t end = i;
+    while (end < s.size() && isLetter(s[end])) ++end;
+    return end - i;
+}
+
+// ------------ Packing ------------
+
+namespace {
+struct Candidate {
+    std::string_view word;
+    int64_t uses;
+
+    // Bytes saved by coding every use in code bytes, less the entry itself
+    int64_t saving(int64_t code) const {
+        const int64_t length = static_cast<int64_t>(word.size());
+        return (length - code) * uses - length;
+    }
+};
+}
+
+// Words, and words with the space before them, chosen greedily by what they
+// save: the best kShortCodes get one-byte codes and the next best two
+static std::vector<std::string_view> trainDictionary(std::string_view text,
+                                                     const std::vector<uint32_t>& start) {
+    std::unordered_map<std::string_view, int64_t> uses;
+    for (size_t t = 0; t + 1 < start.size(); ++t) {
+        const std::string_view s = text.substr(start[t], start[t + 1] - start[t]);
+        for (size_t i = 0; i < s.size();) {
+            const size_t n = letters(s, i);
+            if (n == 0) {
+                ++i;
+                continue;
+            }
+            if (n >= 2) {
+                ++uses[s.substr(i, n)];
+                if (i > 0 && s[i - 1] == ' ') ++uses[s.substr(i - 1, n + 1)];
+            }
+            i += n;
+        }
+    }
+    std::vector<Candidate> candidates;
+    for (const auto& [word, count] : uses) {
+        if (count >= 2) candidates.push_back({word, count});
+    }
+    // Ties go by spelling so the same text always gives the same image
+    auto byCodeLength = [](int64_t code) {
+        return [code](const Candidate& a, const Candidate& b) {
+            const int64_t x = a.saving(code), y = b.saving(code);
+            return x != y ? x > y : a.word < b.word;
+        };
+    };
+    std::sort(candidates.begin(), candidates.end(), byCodeLength(1));
+    std::vector<std::string_view> entries;
+    size_t next = 0;
+    for (; next < candidates.size() && entries.size() < kShortCodes; ++next) {
+        if (candidates[next].saving(1) <= 0) break;
+        entries.push_back(candidates[next].word);
+    }
+    std::sort(candidates.begin() + next, candidates.end(), byCodeLength(2));
+    for (; next < candidates.size() && entries.size() < kShortCodes + kLongCodes; ++next) {
+        if (candidates[next].saving(2) <= 0) break;
+        entries.push_back(candidates[next].word);
+    }
+    return entries;
+}
+
+static void putCode(std::string& out, size_t entry) {
+    if (entry < kShortCodes) {
+        out += static_cast<char>(0x80 + entry);
+    } else {
+        entry -= kShortCodes;
+        out += static_cast<char>(0xf0 + entry / 256);
+        out += static_cast<char>(entry % 256);
+    }
+}
+
+static void encode(std::string_view s, const std::unordered_map<std::string_view, uint32_t>& codes,
+                   std::string& out) {
+    for (size_t i = 0; i < s.size();) {
+        const char c = s[i];
+        if (isLetter(c) || (c == ' ' && i + 1 < s.size() && isLetter(s[i + 1]))) {
+            const size_t word = c == ' ' ? i + 1 : i;
+            const size_t n = letters(s, word);
+            auto found = codes.find(s.substr(i, word + n - i));
+            if (found != codes.end()) {
+                putCode(out, found->second);
+                i = word + n;
+            } else if (c == ' ') {
+                out += ' '; // the word may still be an entry on its own
+                ++i;
+            } else {
+                out.append(s.substr(i, n));
+                i += n;
+            }
+            continue;
+        }
+        if (static_cast<unsigned char>(c) >= 0x80) out += '\xff';
+        out += c;
+        ++i;
+    }
+}
+
+static void putVarint(std::vector<char>& out, size_t n) {
+    for (; n >= 0x80; n >>= 7) out.push_back(static_cast<char>(0x80 | (n & 0x7f)));
+    out.push_back(static_cast<char>(n));
+}
+
+PackedText packText(std::string_view text, const std::vector<uint32_t>& start) {
+    PackedText packed;
+    const std::vector<std::string_view> entries = trainDictionary(text, start);
+    std::unordered_map<std::string_view, uint32_t> codes;
+    packed.dictionaryStart.push_back(0);
+    for (uint32_t e = 0; e < entries.size(); ++e) {
+        codes.emplace(entries[e], e);
+        packed.dictionary.insert(packed.dictionary.end(), entries[e].begin(), entries[e].end());
+        packed.dictionaryStart.push_back(static_cast<uint32_t>(packed.dictionary.size()));
+    }
+
+    const size_t texts = start.size() - 1;
+    std::string coded;
+    packed.blockStart.push_back(0);
+    for (size_t first = 0; first < texts; first += kTextsPerBlock) {
+        const size_t last = std::min<size_t>(texts, first + kTextsPerBlock);
+        for (size_t t = first; t < last; ++t) {
+            coded.clear();
+            encode(text.substr(start[t], start[t + 1] - start[t]), codes, coded);
+            putVarint(packed.blocks, coded.size());
+            packed.blocks.insert(packed.blocks.end(), coded.begin(), coded.end());
+        }
+        packed.blockStart.push_back(static_cast<uint32_t>(packed.blocks.size()));
+        packed.blockLength.push_back(start[last] - start[first]);
+    }
+    return packed;
+}
+
+// ------------ Reading ------------
+
+namespace {
+// A decoded block: its texts are bytes[start[i], start[i + 1])
+struct CachedBlock {
+    uint64_t store = 0;
+    uint32_t block = UINT32_MAX;
+    uint64_t lastUse = 0;
+    uint32_t start[kTextsPerBlock + 1] = {};
+    std::vector<char> bytes;
+};
+
+struct BlockCache {
+    CachedBlock blocks[kCachedBlocks];
+    CachedBlock* last = &blocks[0]; // checked first: texts are mostly read a block at a time
+    uint64_t clock = 0;
+};
+}
+
+static thread_local BlockCache cache;
+
+// Decodes block b into into. Bad bytes in an image cut texts short; nothing
+// is read or written out of bounds.
+static void decodeBlock(const TextStore& store, uint32_t b, CachedBlock& into) {
+    into.store = store.id;
+    into.block = b;
+    // Room for the largest block up front, so slots never grow once warm
+    if (into.bytes.capacity() < store.largestBlock) into.bytes.reserve(store.largestBlock);
+    into.bytes.resize(store.blockLength[b]);
+    char* out = into.bytes.data();
+    const size_t room = into.bytes.size();
+    size_t written = 0;
+
+    const auto* p = reinterpret_cast<const unsigned char*>(store.blocks.first + store.blockStart[b]);
+    const auto* end = reinterpret_cast<const unsigned char*>(store.blocks.first + store.blockStart[b + 1]);
+    const size_t entries = store.dictionaryStart.size() - 1;
+    const uint32_t texts = std::min(kTextsPerBlock, store.count - b * kTextsPerBlock);
+    uint32_t i = 0;
+    for (; i < texts; ++i) {
+        into.start[i] = static_cast<uint32_t>(written);
+        size_t length = 0;
+        for (int shift = 0; p < end && shift < 35; shift += 7) {
+            length |= static_cast<size_t>(*p & 0x7f) << shift;
+            if (!(*p++ & 0x80)) break;
+        }
+        const unsigned char* stop = p + std::min<size_t>(length, static_cast<size_t>(end - p));
+        while (p < stop) {
+            const unsigned char c = *p++;
+            const char* piece = reinterpret_cast<const char*>(p - 1);
+            size_t n = 1;
+            if (c == 0xff) {
+                if (p == stop) break;
+                piece = reinterpret_cast<const char*>(p++);
+            } else if (c >= 0x80) {
+                size_t entry = c - 0x80;
+                if (c >= 0xf0) {
+                    if (p == stop) break;
+                    entry = kShortCodes + (c - 0xf0) * 256 + *p++;
+                }
+                if (entry >= entries) break;
+                piece = store.dictionary.first + store.dictionaryStart[entry];
+                n = store.dictionaryStart[entry + 1] - store.dictionaryStart[entry];
+            }
+            n = std::min(n, room - written);
+            std::memcpy(out + written, piece, n);
+            written += n;
+        }
+        p = stop;
+    }
+    for (; i <= kTextsPerBlock; ++i) into.start[i] = static_cast<uint32_t>(written);
+}
+
+std::string_view TextStore::get(uint32_t t) const {
+    if (t == 0 || t >= count) return {};
+    const uint32_t b = t / kTextsPerBlock;
+    BlockCache& c = cache;
+    CachedBlock* found = c.last;
+    if (found->block != b || found->store != id) {
+        // Least recently used goes
+        CachedBlock* oldest = &c.blocks[0];
+        found = nullptr;
+        for (CachedBlock& slot : c.blocks) {
+            if (slot.block == b && slot.store == id) {
+                found = &slot;
+                break;
+            }
+            if (slot.lastUse < oldest->lastUse) oldest = &slot;
+        }
+        if (!found) {
+            found = oldest;
+            decodeBlock(*this, b, *found);
+        }
+        c.last = found;
+    }
+    found->lastUse = ++c.clock;
+    const uint32_t i = t % kTextsPerBlock;
+    return {found->bytes.data() + found->start[i], found->start[i + 1] - found->start[i]};
+}
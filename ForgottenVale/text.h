@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "span.h"
+
+// Texts are compressed in blocks of this many, so reading one decodes only
+// its block
+constexpr uint32_t kTextsPerBlock = 32;
+// Decoded blocks each thread keeps
+constexpr size_t kCachedBlocks = 64;
+
+// Every piece of prose in a world image, numbered from 0, which is always the
+// empty text. A world's prose is mostly the same few hundred words, so each
+// image carries a dictionary of the words that save the most when replaced
+// by a one- or two-byte code, and texts are coded against it:
+//
+//   0x00-0x7f        the byte itself
+//   0x80-0xef        dictionary entry byte - 0x80
+//   0xf0-0xfe, b     dictionary entry 112 + (byte - 0xf0) * 256 + b
+//   0xff, b          the byte b, for bytes above 0x7f
+//
+// Within a block each text is its coded length as a varint followed by its
+// codes. Blocks stay compressed in the image, which is mapped from disk, so
+// only prose somebody reads is ever paged in, and a small per-thread cache
+// holds the blocks read most recently.
+struct TextStore {
+    Span<char> dictionary;          // entries back to back
+    Span<uint32_t> dictionaryStart; // entry count + 1
+    Span<char> blocks;
+    Span<uint32_t> blockStart;      // block count + 1, into blocks
+    Span<uint32_t> blockLength;     // decoded bytes per block
+    uint32_t count = 0;
+    uint32_t largestBlock = 0;      // decoded bytes
+    uint64_t id = 0; // tells stores apart in the cache: the world's fingerprint
+
+    // Text t, or empty if there is no such text. The view stays valid until
+    // this thread has read from kCachedBlocks other blocks.
+    std::string_view get(uint32_t t) const;
+};
+
+// A store's sections, ready to be written into an image
+struct PackedText {
+    std::vector<char> dictionary;
+    std::vector<uint32_t> dictionaryStart;
+    std::vector<char> blocks;
+    std::vector<uint32_t> blockStart;
+    std::vector<uint32_t> blockLength;
+};
+
+// Trains a dictionary on text and compresses the texts [start[t],
+// start[t + 1]) with it. Text 0 must be empty.
+PackedText packText(std::string_view text, const std::vector<uint32_t>& start);
@@ -0,0 +1,862 @@
+#include "world.h"
+
+#include <algorithm> // std::sort, std::find, std::upper_bound, std::max
+#include <cctype>    // std::tolower
+#include <cstring>   // std::memcpy, std::memcmp
+
+void WorldState::setExitLocked(uint32_t exit, bool locked) {
+    if (exitLocked(exit) != locked) toggledLocks.edit(exit >> 6) ^= uint64_t{1} << (exit & 63);
+}
+
+RoomId World::exitRoom(uint32_t exit) const {
+    // exitStart ascends, so the owner is the last room starting at or before exit
+    auto after = std::upper_bound(exitStart.begin(), exitStart.end(), exit);
+    return static_cast<RoomId>(after - exitStart.begin()) - 1;
+}
+
+std::string_view World::describeItem(Symbol item) const {
+    return item < itemDescription.size() ? str(itemDescription[item]) : std::string_view{};
+}
+
+std::string_view World::useItem(Symbol item) const {
+    return item < itemUse.size() ? str(itemUse[item]) : std::string_view{};
+}
+
+uint64_t roomNameHash(std::string_view text) {
+    uint64_t h = 1469598103934665603ull; // FNV-1a
+    for (char c : text) {
+        h ^= static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c)));
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// ------------ Opening an image ------------
+
+// FNV-1a over [first, last), continuing from h
+static uint64_t hashBytes(uint64_t h, const char* first, const char* last) {
+    for (; first != last; ++first) {
+        h ^= static_cast<unsigned char>(*first);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+template <typename T>
+static bool section(const ImageHeader& header, const char* base, size_t size,
+                    ImageSection id, Span<T>& out) {
+    const uint64_t offset = header.sections[id].offset;
+    const uint64_t count = header.sections[id].count;
+    if (offset % alignof(T) != 0 || offset > size) return false;
+    if (count > (size - offset) / sizeof(T)) return false;
+    const T* first = reinterpret_cast<const T*>(base + offset);
+    out = {first, first + count};
+    return true;
+}
+
+// A CSR start array must have one entry per owner plus one, never decrease,
+// and end exactly at the size of the pool it slices
+static bool validStarts(Span<uint32_t> start, size_t owners, size_t poolSize) {
+    if (start.size() != owners + 1 || start[0] != 0) return false;
+    for (size_t i = 0; i < owners; ++i) {
+        if (start[i] > start[i + 1]) return false;
+    }
+    return start[owners] == poolSize;
+}
+
+bool openWorldImage(std::shared_ptr<const char> image, size_t size, World& world,
+                    std::string& error) {
+    ImageHeader header;
+    if (size < sizeof(header)) {
+        error = "file is too small to be a world image";
+        return false;
+    }
+    std::memcpy(&header, image.get(), sizeof(header));
+    if (std::memcmp(header.magic, kImageMagic, sizeof(kImageMagic)) != 0) {
+        error = "not a world image";
+        return false;
+    }
+    if (header.version != kImageVersion || header.sectionCount != SectionCount) {
+        error = "world image version " + std::to_string(header.version) +
+                " is not supported (expected " + std::to_string(kImageVersion) + ")";
+        return false;
+    }
+
+    const char* base = image.get();
+    World w;
+    Span<uint32_t> symbolOffsets;
+    Span<char> symbolChars;
+    Span<uint64_t> lockBits;
+    bool ok = section(header, base, size, SectionSymbolOffsets, symbolOffsets) &&
+              section(header, base, size, SectionSymbolChars, symbolChars) &&
+              section(header, base, size, SectionText, w.texts.blocks) &&
+              section(header, base, size, SectionTextBlockStart, w.texts.blockStart) &&
+              section(header, base, size, SectionTextBlockLength, w.texts.blockLength) &&
+              section(header, base, size, SectionTextDictionary, w.texts.dictionary) &&
+              section(header, base, size, SectionTextDictionaryStart, w.texts.dictionaryStart) &&
+              section(header, base, size, SectionRoomKey, w.roomKey) &&
+              section(header, base, size, SectionRoomName, w.roomName) &&
+              section(header, base, size, SectionRoomDescription, w.roomDescription) &&
+              section(header, base, size, SectionRoomLabel, w.roomLabel) &&
+              section(header, base, size, SectionExitStart, w.exitStart) &&
+              section(header, base, size, SectionItemStart, w.itemStart) &&
+              section(header, base, size, SectionPoiStart, w.poiStart) &&
+              section(header, base, size, SectionActionStart, w.actionStart) &&
+              section(header, base, size, SectionExitDirection, w.exitDirection) &&
+              section(header, base, size, SectionExitTarget, w.exitTarget) &&
+              section(header, base, size, SectionExitLockBits, lockBits) &&
+              section(header, base, size, SectionItemPool, w.itemPool) &&
+              section(header, base, size, SectionPoiName, w.poiName) &&
+              section(header, base, size, SectionPoiText, w.poiText) &&
+              section(header, base, size, SectionActionName, w.actionName) &&
+              section(header, base, size, SectionActionResult, w.actionResult) &&
+              section(header, base, size, SectionNpcName, w.npcName) &&
+              section(header, base, size, SectionNpcStartNode, w.npcStartNode) &&
+              section(header, base, size, SectionNodeText, w.nodeText) &&
+              section(header, base, size, SectionNodeOptionStart, w.nodeOptionStart) &&
+              section(header, base, size, SectionOptionPrompt, w.optionPrompt) &&
+              section(header, base, size, SectionOptionResponse, w.optionResponse) &&
+              section(header, base, size, SectionOptionTarget, w.optionTarget) &&
+              section(header, base, size, SectionOptionTestStart, w.optionTestStart) &&
+              section(header, base, size, SectionOptionTest, w.optionTest) &&
+              section(header, base, size, SectionOptionEffectStart, w.optionEffectStart) &&
+              section(header, base, size, SectionOptionEffect, w.optionEffect) &&
+              section(header, base, size, SectionItemDescription, w.itemDescription) &&
+              section(header, base, size, SectionItemUse, w.itemUse) &&
+              section(header, base, size, SectionMapLines, w.mapLines) &&
+              section(header, base, size, SectionRecipeOutput, w.recipeOutput) &&
+              section(header, base, size, SectionRecipeYield, w.recipeYield) &&
+              section(header, base, size, SectionRecipeText, w.recipeText) &&
+              section(header, base, size, SectionRecipeInputStart, w.recipeInputStart) &&
+              section(header, base, size, SectionRecipeInputItem, w.recipeInputItem) &&
+              section(header, base, size, SectionRecipeInputCount, w.recipeInputCount) &&
+              section(header, base, size, SectionFlagName, w.flagName) &&
+              section(header, base, size, SectionRuleRoom, w.ruleRoom) &&
+              section(header, base, size, SectionRuleTrigger, w.ruleTrigger) &&
+              section(header, base, size, SectionRuleTestStart, w.ruleTestStart) &&
+              section(header, base, size, SectionRuleTest, w.ruleTest) &&
+              section(header, base, size, SectionRuleEffectStart, w.ruleEffectStart) &&
+              section(header, base, size, SectionRuleEffect, w.ruleEffect) &&
+              section(header, base, size, SectionRoomRegion, w.roomRegion) &&
+              section(header, base, size, SectionRegionName, w.regionName) &&
+              section(header, base, size, SectionEventRegion, w.eventRegion) &&
+              section(header, base, size, SectionEventPeriod, w.eventPeriod) &&
+              section(header, base, size, SectionEventText, w.eventText) &&
+              section(header, base, size, SectionEventTestStart, w.eventTestStart) &&
+              section(header, base, size, SectionEventTest, w.eventTest) &&
+              section(header, base, size, SectionNpcHome, w.npcHome) &&
+              section(header, base, size, SectionNpcStopStart, w.npcStopStart) &&
+              section(header, base, size, SectionStopRoom, w.stopRoom) &&
+              section(header, base, size, SectionStopStay, w.stopStay) &&
+              section(header, base, size, SectionRoomNameTable, w.roomNameTable);
+    if (!ok) {
+        error = "world image is truncated or misaligned";
+        return false;
+    }
+
+    // Structure: parallel arrays agree on their lengths and CSR ranges are sane
+    const size_t rooms = w.roomName.size();
+    const size_t npcs = w.npcName.size();
+    const size_t nodes = w.nodeText.size();
+    const size_t options = w.optionPrompt.size();
+    const size_t recipes = w.recipeOutput.size();
+    const size_t flags = w.flagName.size();
+    const size_t rules = w.ruleTrigger.size();
+    const size_t regions = w.regionName.size();
+    const size_t events = w.eventPeriod.size();
+    const size_t symbols = symbolOffsets.empty() ? 0 : symbolOffsets.size() - 1;
+    ok = !symbolOffsets.empty() && w.roomKey.size() == rooms &&
+         w.roomDescription.size() == rooms && w.roomLabel.size() == rooms &&
+         w.npcHome.size() == npcs && validStarts(w.npcStopStart, npcs, w.stopRoom.size()) &&
+         w.stopStay.size() == w.stopRoom.size() &&
+         validStarts(w.exitStart, rooms, w.exitDirection.size()) &&
+         validStarts(w.itemStart, rooms, w.itemPool.size()) &&
+         validStarts(w.poiStart, rooms, w.poiName.size()) &&
+         validStarts(w.actionStart, rooms, w.actionName.size()) &&
+         validStarts(w.nodeOptionStart, nodes, options) &&
+         validStarts(w.optionTestStart, options, w.optionTest.size()) &&
+         validStarts(w.optionEffectStart, options, w.optionEffect.size()) &&
+         validStarts(symbolOffsets, symbols, symbolChars.size()) &&
+         validStarts(w.recipeInputStart, recipes, w.recipeInputItem.size()) &&
+         validStarts(w.ruleTestStart, rules, w.ruleTest.size()) &&
+         validStarts(w.ruleEffectStart, rules, w.ruleEffect.size()) &&
+         validStarts(w.eventTestStart, events, w.eventTest.size()) &&
+         w.ruleRoom.size() == rules && w.optionTarget.size() == options &&
+         w.roomRegion.size() == rooms && (rooms == 0 || regions > 0) &&
+         w.eventRegion.size() == events && w.eventText.size() == events &&
+         w.exitTarget.size() == w.exitDirection.size() &&
+         lockBits.size() == (w.exitDirection.size() + 63) / 64 &&
+         w.poiText.size() == w.poiName.size() &&
+         w.actionResult.size() == w.actionName.size() &&
+         w.npcStartNode.size() == npcs && w.optionResponse.size() == options &&
+         w.itemDescription.size() == symbols && w.itemUse.size() == symbols &&
+         w.recipeYield.size() == recipes && w.recipeText.size() == recipes &&
+         w.recipeInputCount.size() == w.recipeInputItem.size() &&
+         (rooms == 0 || header.startRoom < rooms) && header.textCount > 0 &&
+         validStarts(w.texts.blockStart, (header.textCount + kTextsPerBlock - 1) / kTextsPerBlock,
+                     w.texts.blocks.size()) &&
+         w.texts.blockLength.size() == w.texts.blockStart.size() - 1 &&
+         !w.texts.dictionaryStart.empty() &&
+         validStarts(w.texts.dictionaryStart, w.texts.dictionaryStart.size() - 1, w.texts.dictionary.size());
+    // A block can't decode to more than its longest code could: this bounds
+    // what reading one may allocate
+    size_t longestEntry = 1;
+    for (size_t e = 0; ok && e + 1 < w.texts.dictionaryStart.size(); ++e)
+        longestEntry = std::max<size_t>(longestEntry, w.texts.dictionaryStart[e + 1] - w.texts.dictionaryStart[e]);
+    for (size_t b = 0; ok && b < w.texts.blockLength.size(); ++b) {
+        ok = w.texts.blockLength[b] <= uint64_t{w.texts.blockStart[b + 1] - w.texts.blockStart[b]} * longestEntry;
+        w.texts.largestBlock = std::max(w.texts.largestBlock, w.texts.blockLength[b]);
+    }
+
+    // References: every index and text range points inside the image
+    auto textOk = [&](Span<TextRef> refs) {
+        for (const TextRef& t : refs) {
+            if (t.id >= header.textCount) return false;
+        }
+        return true;
+    };
+    auto symbolsOk = [&](Span<Symbol> ids) {
+        for (Symbol s : ids) {
+            if (s >= symbols) return false;
+        }
+        return true;
+    };
+    for (RoomId target : w.exitTarget) ok = ok && target < rooms;
+    for (RoomId room : w.npcHome) ok = ok && (room == kNoRoom || room < rooms);
+    for (RoomId room : w.stopRoom) ok = ok && room < rooms;
+    for (uint32_t stay : w.stopStay) ok = ok && stay > 0;
+    for (uint32_t node : w.npcStartNode) ok = ok && node < nodes;
+    for (uint32_t node : w.optionTarget) ok = ok && (node == kNoNode || node < nodes);
+    for (RoomId room : w.ruleRoom) ok = ok && (room == kNoRoom || room < rooms);
+    for (uint32_t region : w.roomRegion) ok = ok && region < regions;
+    for (uint32_t region : w.eventRegion) ok = ok && (region == kNoRegion || region < regions);
+    for (uint32_t period : w.eventPeriod) ok = ok && period > 0;
+    for (const ItemStack& stack : w.itemPool) ok = ok && stack.item < symbols && stack.count > 0;
+    // Lookups stop at an empty slot, so the table must have some
+    size_t namesFiled = 0;
+    for (const RoomNameSlot& slot : w.roomNameTable) {
+        if (slot.room == kNoRoom) continue;
+        ok = ok && slot.room < rooms && slot.kind < RoomNameKindCount;
+        ++namesFiled;
+    }
+    ok = ok && (w.roomNameTable.size() & (w.roomNameTable.size() - 1)) == 0 &&
+         namesFiled * 2 <= w.roomNameTable.size();
+    // Tests only test and effects only act; args name what their kind says
+    auto stepsOk = [&](Span<RuleOp> ops, bool effects) {
+        for (const RuleOp& op : ops) {
+            if (op.kind >= RuleOpCount || (op.kind >= kFirstRuleEffect) != effects) return false;
+            const bool isFlag = op.kind == RuleFlagSet || op.kind == RuleFlagClear ||
+                                op.kind == RuleSetFlag || op.kind == RuleClearFlag;
+            if (op.kind == RuleSay) {
+                if (op.text.id >= header.textCount) return false;
+            } else if (op.arg >= (isFlag ? flags : symbols)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    ok = ok && stepsOk(w.ruleTest, false) && stepsOk(w.ruleEffect, true) &&
+         stepsOk(w.optionTest, false) && stepsOk(w.optionEffect, true) &&
+         stepsOk(w.eventTest, false);
+    for (uint32_t n : w.recipeYield) ok = ok && n > 0;
+    for (uint32_t n : w.recipeInputCount) ok = ok && n > 0;
+    // Each recipe needs at least one input, listed once in item order
+    for (size_t r = 0; ok && r < recipes; ++r) {
+        ok = w.recipeInputStart[r] < w.recipeInputStart[r + 1];
+        for (uint32_t i = w.recipeInputStart[r] + 1; ok && i < w.recipeInputStart[r + 1]; ++i)
+            ok = w.recipeInputItem[i - 1] < w.recipeInputItem[i];
+    }
+    ok = ok && textOk(w.roomKey) && textOk(w.roomName) && textOk(w.roomDescription) &&
+         textOk(w.roomLabel) && textOk(w.poiText) && textOk(w.actionResult) &&
+         textOk(w.nodeText) && textOk(w.optionPrompt) && textOk(w.optionResponse) &&
+         textOk(w.itemDescription) && textOk(w.itemUse) && textOk(w.mapLines) &&
+         textOk(w.recipeText) && textOk(w.regionName) && textOk(w.eventText) && symbolsOk(w.recipeOutput) && symbolsOk(w.recipeInputItem) &&
+         symbolsOk(w.flagName) && symbolsOk(w.ruleTrigger) &&
+         symbolsOk(w.exitDirection) && symbolsOk(w.poiName) &&
+         symbolsOk(w.actionName) && symbolsOk(w.npcName);
+    if (!ok) {
+        error = "world image is corrupt";
+        return false;
+    }
+
+    if (!adoptSymbols(symbolChars.first, symbolOffsets.first, symbols)) {
+        error = "world image names clash with names already in use";
+        return false;
+    }
+
+    w.startRoom = header.startRoom;
+    w.exitLockBits = lockBits;
+    w.fingerprint = header.fingerprint;
+    w.texts.count = header.textCount;
+    w.texts.id = w.fingerprint;
+    w.image = std::move(image);
+    w.imageSize = size;
+    world = std::move(w);
+    return true;
+}
+
+// ------------ Building an image ------------
+
+static uint64_t hashText(std::string_view s) {
+    return hashBytes(1469598103934665603ull, s.data(), s.data() + s.size());
+}
+
+TextRef WorldBuilder::appendText(std::string_view s) {
+    text.append(s);
+    textStart.push_back(static_cast<uint32_t>(text.size()));
+    return {static_cast<uint32_t>(textStart.size() - 2)};
+}
+
+TextRef WorldBuilder::addText(std::string_view s) {
+    if (s.empty()) return {};
+    if (sharedText.empty()) return appendText(s);
+    if ((sharedCount + 1) * 2 > sharedText.size()) growSharedText();
+    const size_t mask = sharedText.size() - 1;
+    for (size_t i = hashText(s) & mask;; i = (i + 1) & mask) {
+        uint32_t& slot = sharedText[i];
+        if (slot == 0) {
+            slot = appendText(s).id;
+            ++sharedCount;
+            return {slot};
+        }
+        if (textOf({slot}) == s) return {slot};
+    }
+}
+
+void WorldBuilder::shareText() {
+    if (sharedText.empty()) sharedText.assign(1024, 0);
+}
+
+// Doubles the table, keeping it at most half full
+void WorldBuilder::growSharedText() {
+    std::vector<uint32_t> old(sharedText.size() * 2, 0);
+    old.swap(sharedText);
+    const size_t mask = sharedText.size() - 1;
+    for (uint32_t id : old) {
+        if (id == 0) continue;
+        size_t i = hashText(textOf({id})) & mask;
+        while (sharedText[i] != 0) i = (i + 1) & mask;
+        sharedText[i] = id;
+    }
+}
+
+RoomId WorldBuilder::addRoom(std::string_view key, std::string_view name,
+                             std::string_view description) {
+    const RoomId id = static_cast<RoomId>(rooms.size());
+    rooms.push_back({addText(key), addText(name), addText(description), {}, 0});
+    roomKeys.emplace(std::string(key), id);
+    return id;
+}
+
+RoomId WorldBuilder::findRoom(std::string_view key) const {
+    auto it = roomKeys.find(std::string(key));
+    return it != roomKeys.end() ? it->second : kNoRoom;
+}
+
+void WorldBuilder::setRoomName(RoomId room, std::string_view name) {
+    rooms[room].name = addText(name);
+}
+
+void WorldBuilder::setRoomDescription(RoomId room, std::string_view description) {
+    rooms[room].description = addText(description);
+}
+
+void WorldBuilder::setRoomLabel(RoomId room, std::string_view label) {
+    rooms[room].label = addText(label);
+}
+
+uint32_t WorldBuilder::addRegion(std::string_view key) {
+    for (uint32_t r = 1; r < regions.size(); ++r) {
+        if (textOf(regions[r]) == key) return r;
+    }
+    regions.push_back(addText(key));
+    return static_cast<uint32_t>(regions.size() - 1);
+}
+
+void WorldBuilder::setRoomRegion(RoomId room, uint32_t region) {
+    rooms[room].region = region;
+}
+
+void WorldBuilder::addExit(RoomId from, Symbol direction, RoomId to, bool locked) {
+    exits.push_back({from, direction, to, locked});
+}
+
+void WorldBuilder::addItem(RoomId room, Symbol item) {
+    items.push_back({room, item});
+}
+
+void WorldBuilder::addPointOfInterest(RoomId room, Symbol name, std::string_view s) {
+    pois.push_back({room, name, addText(s)});
+}
+
+void WorldBuilder::addAction(RoomId room, Symbol action, std::string_view result) {
+    actions.push_back({room, action, addText(result)});
+}
+
+uint32_t WorldBuilder::addNpc(Symbol name, std::string_view greeting) {
+    npcs.push_back({name, addDialogueNode(greeting), kNoRoom});
+    return static_cast<uint32_t>(npcs.size() - 1);
+}
+
+void WorldBuilder::setNpcGreeting(uint32_t npc, std::string_view greeting) {
+    setDialogueNodeText(npcs[npc].startNode, greeting);
+}
+
+uint32_t WorldBuilder::addDialogueNode(std::string_view s) {
+    nodes.push_back(addText(s));
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
+
+void WorldBuilder::setDialogueNodeText(uint32_t node, std::string_view s) {
+    nodes[node] = addText(s);
+}
+
+uint32_t WorldBuilder::addDialogueOption(uint32_t node, std::string_view prompt,
+                                         std::string_view response) {
+    options.push_back({node, addText(prompt), addText(response), node});
+    return static_cast<uint32_t>(options.size() - 1);
+}
+
+void WorldBuilder::setOptionTarget(uint32_t option, uint32_t node) {
+    options[option].target = node;
+}
+
+void WorldBuilder::addOptionTest(uint32_t option, RuleOpKind kind, uint32_t arg) {
+    optionTests.push_back({option, {kind, arg, {}}});
+}
+
+void WorldBuilder::addOptionEffect(uint32_t option, RuleOpKind kind, uint32_t arg) {
+    optionEffects.push_back({option, {kind, arg, {}}});
+}
+
+void WorldBuilder::placeNpc(RoomId room, uint32_t npc) {
+    npcs[npc].home = room;
+}
+
+void WorldBuilder::addScheduleStop(uint32_t npc, RoomId room, uint32_t stay) {
+    stops.push_back({npc, room, stay});
+}
+
+void WorldBuilder::setItemInfo(Symbol item, std::string_view description, std::string_view use) {
+    itemInfo.push_back({item, addText(description), addText(use)});
+}
+
+uint32_t WorldBuilder::addRecipe(Symbol output, uint32_t yield, std::string_view s) {
+    recipes.push_back({output, yield, addText(s)});
+    return static_cast<uint32_t>(recipes.size() - 1);
+}
+
+void WorldBuilder::setRecipeYield(uint32_t recipe, uint32_t yield) {
+    recipes[recipe].yield = yield;
+}
+
+void WorldBuilder::setRecipeText(uint32_t recipe, std::string_view s) {
+    recipes[recipe].text = addText(s);
+}
+
+void WorldBuilder::addRecipeInput(uint32_t recipe, Symbol item, uint32_t count) {
+    inputs.push_back({recipe, item, count});
+}
+
+uint32_t WorldBuilder::addFlag(Symbol name) {
+    auto it = std::find(flags.begin(), flags.end(), name);
+    if (it != flags.end()) return static_cast<uint32_t>(it - flags.begin());
+    flags.push_back(name);
+    return static_cast<uint32_t>(flags.size() - 1);
+}
+
+uint32_t WorldBuilder::addRule(RoomId room, Symbol trigger) {
+    rules.push_back({room, trigger});
+    return static_cast<uint32_t>(rules.size() - 1);
+}
+
+void WorldBuilder::addRuleTest(uint32_t rule, RuleOpKind kind, uint32_t arg) {
+    tests.push_back({rule, {kind, arg, {}}});
+}
+
+void WorldBuilder::addRuleEffect(uint32_t rule, RuleOpKind kind, uint32_t arg, std::string_view s) {
+    effects.push_back({rule, {kind, arg, addText(s)}});
+}
+
+uint32_t WorldBuilder::addEvent(uint32_t region, uint32_t period, std::string_view s) {
+    events.push_back({region, period, addText(s)});
+    return static_cast<uint32_t>(events.size() - 1);
+}
+
+void WorldBuilder::addEventTest(uint32_t event, RuleOpKind kind, uint32_t arg) {
+    eventTests.push_back({event, {kind, arg, {}}});
+}
+
+void WorldBuilder::addMapLine(std::string_view line) {
+    mapLines.push_back(addText(line));
+}
+
+void WorldBuilder::setStartRoom(RoomId room) {
+    startRoom = room;
+}
+
+// Counting sort of defs by owner. Fills start with owners + 1 offsets and
+// returns the defs in owner order, keeping the order they were added in
+// within each owner.
+template <typename Def, typename OwnerOf>
+static std::vector<Def> packBy(const std::vector<Def>& defs, size_t owners,
+                               std::vector<uint32_t>& start, OwnerOf ownerOf) {
+    start.assign(owners + 1, 0);
+    for (const Def& d : defs) ++start[ownerOf(d) + 1];
+    for (size_t r = 0; r < owners; ++r) start[r + 1] += start[r];
+    std::vector<uint32_t> next(start.begin(), start.end() - 1);
+    std::vector<Def> packed(defs.size());
+    for (const Def& d : defs) packed[next[ownerOf(d)]++] = d;
+    return packed;
+}
+
+// Appends sections to an image, each aligned to 8 bytes
+struct ImageWriter {
+    std::vector<char> bytes = std::vector<char>(sizeof(ImageHeader));
+    ImageHeader header{};
+
+    template <typename T>
+    void put(ImageSection id, const std::vector<T>& data) {
+        bytes.resize((bytes.size() + 7) & ~size_t{7});
+        header.sections[id] = {bytes.size(), data.size()};
+        const char* raw = reinterpret_cast<const char*>(data.data());
+        bytes.insert(bytes.end(), raw, raw + data.size() * sizeof(T));
+    }
+
+    std::vector<char> finish(RoomId startRoom) {
+        std::memcpy(header.magic, kImageMagic, sizeof(kImageMagic));
+        header.version = kImageVersion;
+        header.sectionCount = SectionCount;
+        header.startRoom = startRoom;
+        header.fingerprint = 0;
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        header.fingerprint = hashBytes(1469598103934665603ull, bytes.data(), bytes.data() + bytes.size());
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        return std::move(bytes);
+    }
+};
+
+std::vector<char> WorldBuilder::buildImage() const {
+    const size_t roomTotal = rooms.size();
+    ImageWriter out;
+
+    // Names are stored in symbol order so IDs inside the image stay valid
+    std::vector<uint32_t> symbolOffsets{0};
+    std::vector<char> symbolChars;
+    for (Symbol s = 0; s < symbolCount(); ++s) {
+        std::string_view name = symbolText(s);
+        symbolChars.insert(symbolChars.end(), name.begin(), name.end());
+        symbolOffsets.push_back(static_cast<uint32_t>(symbolChars.size()));
+    }
+    out.put(SectionSymbolOffsets, symbolOffsets);
+    out.put(SectionSymbolChars, symbolChars);
+
+    // Rooms are laid out region by region, keeping the order they were added
+    // in within each, so everything about a region sits together in the image
+    // and can be paged in and out as a whole (see paging.h). Room ids in the
+    // image are their places in this order.
+    std::vector<RoomId> roomOrder(roomTotal), regionStart;
+    for (RoomId r = 0; r < roomTotal; ++r) roomOrder[r] = r;
+    roomOrder = packBy(roomOrder, regions.size(), regionStart, [&](RoomId r) { return rooms[r].region; });
+    std::vector<RoomId> placed(roomTotal);
+    for (RoomId i = 0; i < roomTotal; ++i) placed[roomOrder[i]] = i;
+    auto at = [&](RoomId r) { return r == kNoRoom ? kNoRoom : placed[r]; };
+
+    std::vector<uint32_t> exitStart, itemStart, poiStart, actionStart, optionStart;
+    auto packedExits = packBy(exits, roomTotal, exitStart, [&](const ExitDef& e) { return at(e.from); });
+    auto packedItems = packBy(items, roomTotal, itemStart, [&](const ItemDef& d) { return at(d.room); });
+    auto packedPois = packBy(pois, roomTotal, poiStart, [&](const TextDef& d) { return at(d.room); });
+    auto packedActions = packBy(actions, roomTotal, actionStart, [&](const TextDef& d) { return at(d.room); });
+
+    // Texts are numbered in the order rooms first use them, so a region's
+    // prose fills a run of blocks too; prose rooms don't use comes last
+    std::vector<uint32_t> renumber(textStart.size() - 1, 0), textOrder{0};
+    auto number = [&](TextRef t) {
+        if (t.id == 0 || renumber[t.id] != 0) return;
+        renumber[t.id] = static_cast<uint32_t>(textOrder.size());
+        textOrder.push_back(t.id);
+    };
+    for (RoomId i = 0; i < roomTotal; ++i) {
+        const RoomDef& r = rooms[roomOrder[i]];
+        number(r.key);
+        number(r.name);
+        number(r.description);
+        number(r.label);
+        for (uint32_t p = poiStart[i]; p < poiStart[i + 1]; ++p) number(packedPois[p].text);
+        for (uint32_t a = actionStart[i]; a < actionStart[i + 1]; ++a) number(packedActions[a].text);
+    }
+    for (uint32_t t = 1; t < renumber.size(); ++t) number({t});
+    std::string ordered;
+    std::vector<uint32_t> orderedStart{0};
+    ordered.reserve(text.size());
+    for (uint32_t t : textOrder) {
+        ordered.append(textOf({t}));
+        orderedStart.push_back(static_cast<uint32_t>(ordered.size()));
+    }
+    auto moved = [&](TextRef t) { return TextRef{renumber[t.id]}; };
+    auto movedAll = [&](const std::vector<TextRef>& refs) {
+        std::vector<TextRef> result;
+        for (TextRef t : refs) result.push_back(moved(t));
+        return result;
+    };
+
+    const PackedText prose = packText(ordered, orderedStart);
+    out.put(SectionText, prose.blocks);
+    out.put(SectionTextBlockStart, prose.blockStart);
+    out.put(SectionTextBlockLength, prose.blockLength);
+    out.put(SectionTextDictionary, prose.dictionary);
+    out.put(SectionTextDictionaryStart, prose.dictionaryStart);
+    out.header.textCount = static_cast<uint32_t>(textOrder.size());
+
+    std::vector<TextRef> keys, names, descriptions, labels;
+    std::vector<uint32_t> roomRegion;
+    for (RoomId r : roomOrder) {
+        keys.push_back(moved(rooms[r].key));
+        names.push_back(moved(rooms[r].name));
+        descriptions.push_back(moved(rooms[r].description));
+        labels.push_back(moved(rooms[r].label));
+        roomRegion.push_back(rooms[r].region);
+    }
+    out.put(SectionRoomKey, keys);
+    out.put(SectionRoomName, names);
+    out.put(SectionRoomDescription, descriptions);
+    out.put(SectionRoomLabel, labels);
+
+    // Repeats of an item in one room become one stack, so rooms can be read
+    // straight from the image without stacking them on open
+    std::vector<ItemStack> itemPool;
+    ItemSet stacked;
+    for (RoomId r = 0; r < roomTotal; ++r) {
+        stacked.clear();
+        for (uint32_t i = itemStart[r]; i < itemStart[r + 1]; ++i) stacked.add(packedItems[i].item);
+        itemStart[r] = static_cast<uint32_t>(itemPool.size());
+        for (const ItemStack& stack : stacked) itemPool.push_back(stack);
+    }
+    itemStart[roomTotal] = static_cast<uint32_t>(itemPool.size());
+
+    out.put(SectionExitStart, exitStart);
+    out.put(SectionItemStart, itemStart);
+    out.put(SectionPoiStart, poiStart);
+    out.put(SectionActionStart, actionStart);
+
+    std::vector<Symbol> directions;
+    std::vector<RoomId> targets;
+    std::vector<uint64_t> lockBits((packedExits.size() + 63) / 64);
+    for (size_t e = 0; e < packedExits.size(); ++e) {
+        directions.push_back(packedExits[e].direction);
+        targets.push_back(at(packedExits[e].to));
+        if (packedExits[e].locked) lockBits[e >> 6] |= uint64_t{1} << (e & 63);
+    }
+    out.put(SectionExitDirection, directions);
+    out.put(SectionExitTarget, targets);
+    out.put(SectionExitLockBits, lockBits);
+    out.put(SectionItemPool, itemPool);
+
+    std::vector<Symbol> poiName, actionName;
+    std::vector<TextRef> poiText, actionResult;
+    for (const TextDef& p : packedPois) {
+        poiName.push_back(p.name);
+        poiText.push_back(moved(p.text));
+    }
+    for (const TextDef& a : packedActions) {
+        actionName.push_back(a.name);
+        actionResult.push_back(moved(a.text));
+    }
+    out.put(SectionPoiName, poiName);
+    out.put(SectionPoiText, poiText);
+    out.put(SectionActionName, actionName);
+    out.put(SectionActionResult, actionResult);
+
+    // Options are packed by node, so option ids in the image differ from
+    // the order they were added in; targets refer to nodes and stay valid
+    std::vector<uint32_t> optionOrder(options.size());
+    for (uint32_t o = 0; o < options.size(); ++o) optionOrder[o] = o;
+    optionOrder = packBy(optionOrder, nodes.size(), optionStart, [&](uint32_t o) { return options[o].node; });
+    std::vector<uint32_t> packedId(options.size());
+    for (uint32_t i = 0; i < optionOrder.size(); ++i) packedId[optionOrder[i]] = i;
+
+    std::vector<Symbol> npcName;
+    std::vector<RoomId> npcHome;
+    std::vector<uint32_t> npcStart, optionTarget;
+    std::vector<TextRef> prompts, responses;
+    for (const NpcDef& n : npcs) {
+        npcName.push_back(n.name);
+        npcStart.push_back(n.startNode);
+        npcHome.push_back(at(n.home));
+    }
+    for (uint32_t o : optionOrder) {
+        prompts.push_back(moved(options[o].prompt));
+        responses.push_back(moved(options[o].response));
+        optionTarget.push_back(options[o].target);
+    }
+    // Steps in owner order, with their text renumbered
+    auto byOwner = [](const StepDef& d) { return d.owner; };
+    auto stepOps = [&](const std::vector<StepDef>& packed) {
+        std::vector<RuleOp> ops;
+        for (const StepDef& s : packed) ops.push_back({s.op.kind, s.op.arg, moved(s.op.text)});
+        return ops;
+    };
+    auto packSteps = [&](const std::vector<StepDef>& steps, std::vector<uint32_t>& start) {
+        std::vector<StepDef> renumbered = steps;
+        for (StepDef& s : renumbered) s.owner = packedId[s.owner];
+        return stepOps(packBy(renumbered, options.size(), start, byOwner));
+    };
+    std::vector<uint32_t> optionTestStart, optionEffectStart;
+    std::vector<RuleOp> optionTestOps = packSteps(optionTests, optionTestStart);
+    std::vector<RuleOp> optionEffectOps = packSteps(optionEffects, optionEffectStart);
+    out.put(SectionNpcName, npcName);
+    out.put(SectionNpcStartNode, npcStart);
+    out.put(SectionNodeText, movedAll(nodes));
+    out.put(SectionNodeOptionStart, optionStart);
+    out.put(SectionOptionPrompt, prompts);
+    out.put(SectionOptionResponse, responses);
+    out.put(SectionOptionTarget, optionTarget);
+    out.put(SectionOptionTestStart, optionTestStart);
+    out.put(SectionOptionTest, optionTestOps);
+    out.put(SectionOptionEffectStart, optionEffectStart);
+    out.put(SectionOptionEffect, optionEffectOps);
+
+    std::vector<TextRef> describe(symbolCount()), use(symbolCount());
+    for (const ItemInfo& info : itemInfo) {
+        describe[info.item] = moved(info.description);
+        use[info.item] = moved(info.use);
+    }
+    out.put(SectionItemDescription, describe);
+    out.put(SectionItemUse, use);
+    out.put(SectionMapLines, movedAll(mapLines));
+
+    std::vector<Symbol> recipeOutput;
+    std::vector<uint32_t> recipeYield;
+    std::vector<TextRef> recipeText;
+    for (const RecipeDef& r : recipes) {
+        recipeOutput.push_back(r.output);
+        recipeYield.push_back(r.yield);
+        recipeText.push_back(moved(r.text));
+    }
+    // Inputs sorted by item with repeats merged, so equal recipes look equal
+    std::vector<InputDef> sortedInputs = inputs;
+    std::sort(sortedInputs.begin(), sortedInputs.end(), [](const InputDef& a, const InputDef& b) {
+        return a.recipe != b.recipe ? a.recipe < b.recipe : a.item < b.item;
+    });
+    std::vector<InputDef> merged;
+    for (const InputDef& i : sortedInputs) {
+        if (!merged.empty() && merged.back().recipe == i.recipe && merged.back().item == i.item)
+            merged.back().count += i.count;
+        else
+            merged.push_back(i);
+    }
+    std::vector<uint32_t> inputStart;
+    auto packedInputs = packBy(merged, recipes.size(), inputStart, [](const InputDef& d) { return d.recipe; });
+    std::vector<Symbol> inputItem;
+    std::vector<uint32_t> inputCount;
+    for (const InputDef& i : packedInputs) {
+        inputItem.push_back(i.item);
+        inputCount.push_back(i.count);
+    }
+    out.put(SectionRecipeOutput, recipeOutput);
+    out.put(SectionRecipeYield, recipeYield);
+    out.put(SectionRecipeText, recipeText);
+    out.put(SectionRecipeInputStart, inputStart);
+    out.put(SectionRecipeInputItem, inputItem);
+    out.put(SectionRecipeInputCount, inputCount);
+    out.put(SectionFlagName, flags);
+
+    std::vector<RoomId> ruleRoom;
+    std::vector<Symbol> ruleTrigger;
+    for (const RuleDef& r : rules) {
+        ruleRoom.push_back(at(r.room));
+        ruleTrigger.push_back(r.trigger);
+    }
+    std::vector<uint32_t> testStart, effectStart;
+    std::vector<RuleOp> testOps = stepOps(packBy(tests, rules.size(), testStart, byOwner));
+    std::vector<RuleOp> effectOps = stepOps(packBy(effects, rules.size(), effectStart, byOwner));
+    out.put(SectionRuleRoom, ruleRoom);
+    out.put(SectionRuleTrigger, ruleTrigger);
+    out.put(SectionRuleTestStart, testStart);
+    out.put(SectionRuleTest, testOps);
+    out.put(SectionRuleEffectStart, effectStart);
+    out.put(SectionRuleEffect, effectOps);
+    out.put(SectionRoomRegion, roomRegion);
+    out.put(SectionRegionName, movedAll(regions));
+
+    std::vector<uint32_t> eventRegion, eventPeriod, eventTestStart;
+    std::vector<TextRef> eventText;
+    for (const EventDef& e : events) {
+        eventRegion.push_back(e.region);
+        eventPeriod.push_back(e.period);
+        eventText.push_back(moved(e.text));
+    }
+    std::vector<RuleOp> eventTestOps = stepOps(packBy(eventTests, events.size(), eventTestStart, byOwner));
+    out.put(SectionEventRegion, eventRegion);
+    out.put(SectionEventPeriod, eventPeriod);
+    out.put(SectionEventText, eventText);
+    out.put(SectionEventTestStart, eventTestStart);
+    out.put(SectionEventTest, eventTestOps);
+
+    std::vector<uint32_t> stopStart, stopStay;
+    std::vector<RoomId> stopRoom;
+    for (const StopDef& d : packBy(stops, npcs.size(), stopStart, [](const StopDef& d) { return d.npc; })) {
+        stopRoom.push_back(at(d.room));
+        stopStay.push_back(d.stay);
+    }
+    out.put(SectionNpcHome, npcHome);
+    out.put(SectionNpcStopStart, stopStart);
+    out.put(SectionStopRoom, stopRoom);
+    out.put(SectionStopStay, stopStay);
+
+    // Names are told apart by their text, not just their hashes, so two
+    // names that happen to collide are both filed
+    auto nameText = [&](RoomId i, uint32_t kind) {
+        const RoomDef& r = rooms[roomOrder[i]];
+        return textOf(kind == RoomNameKey ? r.key : kind == RoomNameLabel ? r.label : r.name);
+    };
+    auto sameName = [](std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+                return false;
+        }
+        return true;
+    };
+    std::vector<RoomNameSlot> nameTable(16);
+    size_t namesFiled = 0;
+    auto fileName = [&](RoomId room, uint32_t kind) {
+        if ((namesFiled + 1) * 2 > nameTable.size()) {
+            std::vector<RoomNameSlot> old(nameTable.size() * 2);
+            old.swap(nameTable);
+            const size_t mask = nameTable.size() - 1;
+            for (const RoomNameSlot& slot : old) {
+                if (slot.room == kNoRoom) continue;
+                size_t i = slot.hash & mask;
+                while (nameTable[i].room != kNoRoom) i = (i + 1) & mask;
+                nameTable[i] = slot;
+            }
+        }
+        const std::string_view name = nameText(room, kind);
+        const uint64_t hash = roomNameHash(name);
+        const size_t mask = nameTable.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            RoomNameSlot& slot = nameTable[i];
+            if (slot.room == kNoRoom) {
+                slot = {hash, room, kind};
+                ++namesFiled;
+                return;
+            }
+            if (slot.hash == hash && sameName(nameText(slot.room, slot.kind), name)) return;
+        }
+    };
+    for (RoomId i = 0; i < roomTotal; ++i) fileName(i, RoomNameKey);
+    for (RoomId i = 0; i < roomTotal; ++i) {
+        if (rooms[roomOrder[i]].label.id) fileName(i, RoomNameLabel);
+        fileName(i, RoomNameName);
+    }
+    out.put(SectionRoomNameTable, nameTable);
+
+    return out.finish(roomTotal ? at(startRoom) : 0);
+}
+
+bool WorldBuilder::build(World& world, std::string& error) const {
+    auto bytes = std::make_shared<std::vector<char>>(buildImage());
+    std::shared_ptr<const char> image(bytes, bytes->data()); // shares ownership of the buffer
+    return openWorldImage(std::move(image), bytes->size(), world, error);
+}
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "items.h"
+#include "persistent.h"
+#include "span.h"
+#include "symbols.h"
+#include "text.h"
+
+using RoomId = uint32_t;
+constexpr RoomId kNoRoom = UINT32_MAX;
+constexpr uint32_t kNoNpc = UINT32_MAX;
+constexpr uint32_t kNoExit = UINT32_MAX;
+constexpr uint32_t kNoFlag = UINT32_MAX;
+constexpr uint32_t kNoNode = UINT32_MAX; // no conversation, or one that ends
+constexpr uint32_t kNoRule = UINT32_MAX;
+constexpr uint32_t kNoRegion = UINT32_MAX; // for timed events: every region
+
+// A piece of prose: its number in World::texts, 0 for none
+struct TextRef {
+    uint32_t id = 0;
+};
+
+// What a rule step does (see worldfile.h). Tests come first; a rule fires
+// only if all of its tests pass, and then runs its effects in order.
+enum RuleOpKind : uint32_t {
+    RuleCarrying,   // arg = item
+    RuleLacking,    // arg = item
+    RuleFlagSet,    // arg = flag
+    RuleFlagClear,  // arg = flag
+    RuleExitLocked, // arg = direction, in the player's room
+    RuleExitOpen,   // arg = direction
+    RuleUnlock,     // arg = direction
+    RuleLock,       // arg = direction
+    RuleGive,       // arg = item
+    RuleTake,       // arg = item
+    RuleSetFlag,    // arg = flag
+    RuleClearFlag,  // arg = flag
+    RuleSay,        // prints text
+    RuleOpCount
+};
+constexpr uint32_t kFirstRuleEffect = RuleUnlock;
+
+struct RuleOp {
+    uint32_t kind = RuleSay;
+    uint32_t arg = 0;
+    TextRef text;
+};
+
+// The names a player can travel to a room by
+enum RoomNameKind : uint32_t { RoomNameKey, RoomNameLabel, RoomNameName, RoomNameKindCount };
+
+// One slot of a world's table of room names, filed by roomNameHash. A name
+// isn't copied into the table; finding it checks the room's own text.
+struct RoomNameSlot {
+    uint64_t hash = 0;
+    RoomId room = kNoRoom; // kNoRoom in an empty slot
+    uint32_t kind = RoomNameKey;
+};
+
+// FNV-1a of text in lower case, which is how typed input arrives
+uint64_t roomNameHash(std::string_view text);
+
+// Binary world image: a header followed by one 8-byte aligned array per
+// section. Everything inside refers to other data by index or offset, so an
+// image can be mapped from disk and used in place.
+constexpr char kImageMagic[8] = {'V', 'A', 'L', 'E', 'W', 'L', 'D', '\0'};
+constexpr uint32_t kImageVersion = 10;
+
+enum ImageSection : uint32_t {
+    SectionSymbolOffsets, // uint32_t, symbol count + 1
+    SectionSymbolChars,   // char
+    SectionText,          // char, compressed blocks of prose (see text.h)
+    SectionTextBlockStart,  // uint32_t, block count + 1
+    SectionTextBlockLength, // uint32_t per block, decoded
+    SectionTextDictionary,  // char
+    SectionTextDictionaryStart, // uint32_t, entry count + 1
+    SectionRoomKey,       // TextRef per room
+    SectionRoomName,      // TextRef per room
+    SectionRoomDescription,
+    SectionRoomLabel,
+    SectionExitStart,     // uint32_t, room count + 1
+    SectionItemStart,
+    SectionPoiStart,
+    SectionActionStart,
+    SectionExitDirection, // Symbol per exit
+    SectionExitTarget,    // RoomId per exit
+    SectionExitLockBits,  // uint64_t, one bit per exit
+    SectionItemPool,      // ItemStack, each item once per room in arrival order
+    SectionPoiName,       // Symbol
+    SectionPoiText,       // TextRef
+    SectionActionName,    // Symbol
+    SectionActionResult,  // TextRef
+    SectionNpcName,       // Symbol per NPC
+    SectionNpcStartNode,  // uint32_t per NPC
+    SectionNodeText,      // TextRef per dialogue node
+    SectionNodeOptionStart, // uint32_t, node count + 1
+    SectionOptionPrompt,  // TextRef per option
+    SectionOptionResponse,
+    SectionOptionTarget,  // uint32_t per option: a node, or kNoNode to end
+    SectionOptionTestStart, // uint32_t, option count + 1
+    SectionOptionTest,      // RuleOp
+    SectionOptionEffectStart,
+    SectionOptionEffect,
+    SectionItemDescription, // TextRef per symbol
+    SectionItemUse,         // TextRef per symbol
+    SectionMapLines,        // TextRef
+    SectionRecipeOutput,    // Symbol per recipe
+    SectionRecipeYield,     // uint32_t per recipe
+    SectionRecipeText,      // TextRef per recipe
+    SectionRecipeInputStart, // uint32_t, recipe count + 1
+    SectionRecipeInputItem,  // Symbol, strictly increasing within a recipe
+    SectionRecipeInputCount, // uint32_t
+    SectionFlagName,        // Symbol per flag
+    SectionRuleRoom,        // RoomId per rule, kNoRoom for any room
+    SectionRuleTrigger,     // Symbol per rule
+    SectionRuleTestStart,   // uint32_t, rule count + 1
+    SectionRuleTest,        // RuleOp
+    SectionRuleEffectStart, // uint32_t, rule count + 1
+    SectionRuleEffect,      // RuleOp
+    SectionRoomRegion,      // uint32_t per room
+    SectionRegionName,      // TextRef per region
+    SectionEventRegion,     // uint32_t per event, kNoRegion for any
+    SectionEventPeriod,     // uint32_t per event, in ticks
+    SectionEventText,       // TextRef per event
+    SectionEventTestStart,  // uint32_t, event count + 1
+    SectionEventTest,       // RuleOp
+    SectionNpcHome,         // RoomId per NPC, kNoRoom if placed nowhere
+    SectionNpcStopStart,    // uint32_t, NPC count + 1
+    SectionStopRoom,        // RoomId per schedule stop
+    SectionStopStay,        // uint32_t per schedule stop, in ticks
+    SectionRoomNameTable,   // RoomNameSlot, open addressing, power-of-two count
+    SectionCount
+};
+
+struct ImageHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t startRoom;
+    uint32_t textCount;
+    uint64_t fingerprint; // of the whole image with this field zero, see World::fingerprint
+    struct {
+        uint64_t offset; // from the start of the image
+        uint64_t count;  // elements, not bytes
+    } sections[SectionCount];
+};
+
+// The whole map stored as parallel arrays indexed by RoomId. Variable-length
+// per-room data (exits, items, points of interest, actions) lives in flat
+// pools, and room r owns the slice [xStart[r], xStart[r + 1]) of each pool,
+// so walking a room's exits or listing its contents touches a few contiguous
+// cache lines instead of chasing pointers across the heap.
+//
+// Every Span points into a binary world image, either built in memory or
+// mapped straight from a file. A World never changes once opened, so any
+// number of sessions can read one concurrently; what a playthrough changes
+// lives in a WorldState.
+struct World {
+    // Per room
+    Span<TextRef> roomKey; // identifier used in world files, e.g. "glade"
+    Span<TextRef> roomName;
+    Span<TextRef> roomDescription;
+    Span<TextRef> roomLabel; // short name marked on the map, may be empty
+    Span<uint32_t> exitStart;
+    Span<uint32_t> itemStart;
+    Span<uint32_t> poiStart;
+    Span<uint32_t> actionStart;
+
+    // Per exit
+    Span<Symbol> exitDirection;
+    Span<RoomId> exitTarget;
+
+    // Pools
+    Span<ItemStack> itemPool; // items each room starts with, one stack per item
+    Span<Symbol> poiName;
+    Span<TextRef> poiText;
+    Span<Symbol> actionName;
+    Span<TextRef> actionResult; // empty if the action has no special text
+
+    // NPCs and their dialogue. A conversation is a walk through a graph:
+    // each node has some text and a slice of options, and each option has
+    // a prompt, the reply it gets, tests that decide whether it is offered,
+    // effects (as in rules) and the node it leads to.
+    Span<Symbol> npcName;
+    Span<uint32_t> npcStartNode; // whose text is the NPC's greeting
+    // Where each NPC is: an NPC with a schedule walks its stops
+    // [npcStopStart[n], npcStopStart[n + 1]) in a loop, staying stopStay
+    // ticks at each, starting at the first on tick 0. One without stays at
+    // its home.
+    Span<RoomId> npcHome;
+    Span<uint32_t> npcStopStart;
+    Span<RoomId> stopRoom;
+    Span<uint32_t> stopStay;
+    // Rooms by key, label and name, at most half full (see RouteIndex).
+    // Keys come first, so a label or name never shadows another room's key,
+    // and a name many rooms share is filed once, for the first of them.
+    Span<RoomNameSlot> roomNameTable;
+    Span<TextRef> nodeText;      // shown on arriving at the node, may be empty
+    Span<uint32_t> nodeOptionStart;
+    Span<TextRef> optionPrompt;
+    Span<TextRef> optionResponse;
+    Span<uint32_t> optionTarget; // next node, or kNoNode to end the conversation
+    Span<uint32_t> optionTestStart;
+    Span<RuleOp> optionTest;
+    Span<uint32_t> optionEffectStart;
+    Span<RuleOp> optionEffect;
+
+    // Named flags a playthrough can set, such as quest progress
+    Span<Symbol> flagName;
+
+    // Scripted behaviour: rule r applies when the player does ruleTrigger[r]
+    // (a room action or a whole typed phrase) in ruleRoom[r]. Its tests and
+    // effects are the slices [ruleTestStart[r], ruleTestStart[r + 1]) and
+    // [ruleEffectStart[r], ruleEffectStart[r + 1]).
+    Span<RoomId> ruleRoom;
+    Span<Symbol> ruleTrigger;
+    Span<uint32_t> ruleTestStart;
+    Span<RuleOp> ruleTest;
+    Span<uint32_t> ruleEffectStart;
+    Span<RuleOp> ruleEffect;
+
+    // Regions group rooms that share weather and timed events. Region 0 has
+    // no name and holds every room not placed in another.
+    Span<uint32_t> roomRegion;
+    Span<TextRef> regionName;
+
+    // Timed events: event e shows eventText[e] every eventPeriod[e] world
+    // ticks while the player is in eventRegion[e], if its tests (rule tests,
+    // [eventTestStart[e], eventTestStart[e + 1])) hold
+    Span<uint32_t> eventRegion;
+    Span<uint32_t> eventPeriod;
+    Span<TextRef> eventText;
+    Span<uint32_t> eventTestStart;
+    Span<RuleOp> eventTest;
+
+    // Indexed by Symbol; empty for names that are not items
+    Span<TextRef> itemDescription;
+    Span<TextRef> itemUse;
+
+    // Crafting: recipe r turns the inputs [recipeInputStart[r],
+    // recipeInputStart[r + 1]) into recipeYield[r] of recipeOutput[r]
+    Span<Symbol> recipeOutput;
+    Span<uint32_t> recipeYield;
+    Span<TextRef> recipeText; // shown when crafting, may be empty
+    Span<uint32_t> recipeInputStart;
+    Span<Symbol> recipeInputItem;
+    Span<uint32_t> recipeInputCount;
+
+    Span<TextRef> mapLines;
+    TextStore texts; // every piece of prose and every label
+    Span<uint64_t> exitLockBits; // how each exit starts out, one bit per exit
+    RoomId startRoom = 0;
+
+    // Keeps the image alive: an owned buffer or a file mapping
+    std::shared_ptr<const char> image;
+    size_t imageSize = 0;
+    bool mapped = false; // from a file, so pages can be let go and read back
+    // Hash of the image; saves record which world they belong to. It is
+    // taken when the image is built and kept in its header, so opening one
+    // reads nothing but the header to know it.
+    uint64_t fingerprint = 0;
+
+    size_t roomCount() const { return roomName.size(); }
+    size_t recipeCount() const { return recipeOutput.size(); }
+    size_t flagCount() const { return flagName.size(); }
+    size_t nodeCount() const { return nodeText.size(); }
+    size_t npcCount() const { return npcName.size(); }
+    size_t ruleCount() const { return ruleTrigger.size(); }
+    size_t regionCount() const { return regionName.size(); }
+    size_t eventCount() const { return eventPeriod.size(); }
+    // Valid until this thread has read kCachedBlocks other blocks of prose
+    std::string_view str(TextRef ref) const { return texts.get(ref.id); }
+
+    // Room the exit leads out of
+    RoomId exitRoom(uint32_t exit) const;
+
+    std::string_view describeItem(Symbol item) const;
+    std::string_view useItem(Symbol item) const;
+};
+
+// How one room differs for one playthrough
+struct RoomChange {
+    uint32_t version = 0;  // moves on with every change to the room
+    bool hasItems = false; // items stands in for the room's slice of World::itemPool
+    ItemSet items;
+};
+
+// What one playthrough has changed. Locks are kept as the exits toggled from
+// how the world starts them; rooms the player has taken from or dropped into
+// get their own item set, everything else keeps reading World::itemPool.
+// Every change to a room bumps its version, so anything derived from how a
+// room looks can be kept until the version moves on.
+//
+// Both live in persistent arrays, so a copy, such as a checkpoint or a
+// forked session, takes constant time and shares every room neither side
+// has changed since: what a state costs is what its player changed.
+struct WorldState {
+    Span<uint64_t> startLocks; // World::exitLockBits
+    PersistentArray<uint64_t, 3> toggledLocks; // one bit per exit
+    PersistentArray<RoomChange, 0> rooms;
+
+    WorldState() = default;
+    explicit WorldState(const World& world)
+        : startLocks(world.exitLockBits), toggledLocks(world.exitLockBits.size()), rooms(world.roomCount()) {}
+
+    bool exitLocked(uint32_t exit) const {
+        return ((startLocks[exit >> 6] ^ toggledLocks[exit >> 6]) >> (exit & 63)) & 1u;
+    }
+    void setExitLocked(uint32_t exit, bool locked);
+
+    uint32_t roomVersion(RoomId room) const { return rooms[room].version; }
+    void touchRoom(RoomId room) { ++rooms.edit(room).version; }
+};
+
+// Points a World at an image of size bytes after checking that the header and
+// every reference inside are in range. Registers the image's names with the
+// symbol table. Returns false and sets error if the image can't be used.
+bool openWorldImage(std::shared_ptr<const char> image, size_t size, World& world,
+                    std::string& error);
+
+// Collects rooms in any order and packs them into a world image
+struct WorldBuilder {
+    RoomId addRoom(std::string_view key, std::string_view name, std::string_view description);
+    RoomId findRoom(std::string_view key) const;
+    void setRoomName(RoomId room, std::string_view name);
+    void setRoomDescription(RoomId room, std::string_view description);
+    void setRoomLabel(RoomId room, std::string_view label);
+    // Index of the region with this key, added the first time it is seen
+    uint32_t addRegion(std::string_view key);
+    void setRoomRegion(RoomId room, uint32_t region);
+    void addExit(RoomId from, Symbol direction, RoomId to, bool locked = false);
+    void addItem(RoomId room, Symbol item);
+    void addPointOfInterest(RoomId room, Symbol name, std::string_view text);
+    void addAction(RoomId room, Symbol action, std::string_view result = {});
+    // Also adds the node conversations with the NPC start from
+    uint32_t addNpc(Symbol name, std::string_view greeting);
+    void setNpcGreeting(uint32_t npc, std::string_view greeting);
+    uint32_t npcStartNode(uint32_t npc) const { return npcs[npc].startNode; }
+    uint32_t addDialogueNode(std::string_view text = {});
+    void setDialogueNodeText(uint32_t node, std::string_view text);
+    // Options lead back to their own node until given another target
+    uint32_t addDialogueOption(uint32_t node, std::string_view prompt, std::string_view response);
+    void setOptionTarget(uint32_t option, uint32_t node);
+    void addOptionTest(uint32_t option, RuleOpKind kind, uint32_t arg);
+    void addOptionEffect(uint32_t option, RuleOpKind kind, uint32_t arg);
+    // Several NPCs may share a room
+    void placeNpc(RoomId room, uint32_t npc);
+    void addScheduleStop(uint32_t npc, RoomId room, uint32_t stay);
+    void setItemInfo(Symbol item, std::string_view description, std::string_view use = {});
+    uint32_t addRecipe(Symbol output, uint32_t yield = 1, std::string_view text = {});
+    void setRecipeYield(uint32_t recipe, uint32_t yield);
+    void setRecipeText(uint32_t recipe, std::string_view text);
+    // Naming an input twice adds up the counts
+    void addRecipeInput(uint32_t recipe, Symbol item, uint32_t count = 1);
+    // Index of the flag with this name, added the first time it is seen
+    uint32_t addFlag(Symbol name);
+    uint32_t addRule(RoomId room, Symbol trigger);
+    void addRuleTest(uint32_t rule, RuleOpKind kind, uint32_t arg);
+    void addRuleEffect(uint32_t rule, RuleOpKind kind, uint32_t arg, std::string_view text = {});
+    uint32_t addEvent(uint32_t region, uint32_t period, std::string_view text);
+    void addEventTest(uint32_t event, RuleOpKind kind, uint32_t arg);
+    void addMapLine(std::string_view line);
+    void setStartRoom(RoomId room);
+    // From now on, text that repeats text added since is stored only once.
+    // Generated worlds draw most of their prose from a few tables.
+    void shareText();
+
+    size_t roomCount() const { return rooms.size(); }
+
+    // Serialises everything added so far, together with the current symbol
+    // table, into a versioned image
+    std::vector<char> buildImage() const;
+    // Builds the image in memory and opens it into world. Returns false and
+    // sets error if it can't be opened, as openWorldImage does.
+    bool build(World& world, std::string& error) const;
+
+private:
+    struct RoomDef { TextRef key, name, description, label; uint32_t region; };
+    struct ExitDef { RoomId from; Symbol direction; RoomId to; bool locked; };
+    struct ItemDef { RoomId room; Symbol item; };
+    struct TextDef { RoomId room; Symbol name; TextRef text; };
+    struct NpcDef { Symbol name; uint32_t startNode; RoomId home; };
+    struct StopDef { uint32_t npc; RoomId room; uint32_t stay; };
+    struct OptionDef { uint32_t node; TextRef prompt, response; uint32_t target; };
+    struct ItemInfo { Symbol item; TextRef description, use; };
+    struct RecipeDef { Symbol output; uint32_t yield; TextRef text; };
+    struct InputDef { uint32_t recipe; Symbol item; uint32_t count; };
+    struct RuleDef { RoomId room; Symbol trigger; };
+    struct EventDef { uint32_t region, period; TextRef text; };
+    struct StepDef { uint32_t owner; RuleOp op; }; // owner is a rule or an option
+
+    TextRef addText(std::string_view s);
+    TextRef appendText(std::string_view s);
+    std::string_view textOf(TextRef ref) const {
+        return std::string_view(text).substr(textStart[ref.id], textStart[ref.id + 1] - textStart[ref.id]);
+    }
+    void growSharedText();
+
+    // Text t is [textStart[t], textStart[t + 1]); text 0 is empty
+    std::string text;
+    std::vector<uint32_t> textStart{0, 0};
+    // Open addressing over hashes of shared text; empty unless shareText()
+    // was called, and empty slots hold text 0
+    std::vector<uint32_t> sharedText;
+    size_t sharedCount = 0;
+    std::vector<RoomDef> rooms;
+    std::unordered_map<std::string, RoomId> roomKeys;
+    std::vector<ExitDef> exits;
+    std::vector<ItemDef> items;
+    std::vector<TextDef> pois;
+    std::vector<TextDef> actions;
+    std::vector<NpcDef> npcs;
+    std::vector<StopDef> stops;
+    std::vector<TextRef> nodes;
+    std::vector<OptionDef> options;
+    std::vector<StepDef> optionTests;
+    std::vector<StepDef> optionEffects;
+    std::vector<ItemInfo> itemInfo;
+    std::vector<RecipeDef> recipes;
+    std::vector<InputDef> inputs;
+    std::vector<Symbol> flags;
+    std::vector<RuleDef> rules;
+    std::vector<StepDef> tests;
+    std::vector<StepDef> effects;
+    std::vector<TextRef> regions{TextRef{}}; // keys; region 0 is the default
+    std::vector<EventDef> events;
+    std::vector<StepDef> eventTests;
+    std::vector<TextRef> mapLines;
+    RoomId startRoom = 0;
+};
@@ -0,0 +1,554 @@
+#include "worldfile.h"
+
+#include <algorithm>     // std::find_if
+#include <cstdio>        // std::snprintf
+#include <cctype>        // std::tolower
+#include <cstring>       // std::memcmp
+#include <fstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "campaign.h"
+
+static std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r')) s.remove_suffix(1);
+    return s;
+}
+
+// Splits "a | b | c" into trimmed fields
+static std::vector<std::string_view> fields(std::string_view value) {
+    std::vector<std::string_view> out;
+    while (true) {
+        size_t bar = value.find('|');
+        out.push_back(trim(value.substr(0, bar)));
+        if (bar == std::string_view::npos) break;
+        value.remove_prefix(bar + 1);
+    }
+    return out;
+}
+
+// A rule test or effect such as "carrying: rusty key" or "set: torch quest",
+// taking an item, a flag or a direction. Dialogue options use the same words.
+static bool parseStep(std::string_view key, std::string_view value, WorldBuilder& builder, RuleOp& op) {
+    static const struct { const char* key; RuleOpKind kind; bool flag; } steps[] = {
+        {"carrying", RuleCarrying, false}, {"lacking", RuleLacking, false},
+        {"flag", RuleFlagSet, true},       {"unless", RuleFlagClear, true},
+        {"locked", RuleExitLocked, false}, {"open", RuleExitOpen, false},
+        {"unlock", RuleUnlock, false},     {"lock", RuleLock, false},
+        {"give", RuleGive, false},         {"take", RuleTake, false},
+        {"set", RuleSetFlag, true},        {"clear", RuleClearFlag, true},
+    };
+    auto step = std::find_if(std::begin(steps), std::end(steps),
+                             [&](const auto& s) { return key == s.key; });
+    if (step == std::end(steps) || value.empty()) return false;
+    op.kind = step->kind;
+    op.arg = step->flag ? builder.addFlag(intern(value)) : intern(value);
+    return true;
+}
+
+static bool containsFarewell(std::string_view s) {
+    static const char word[] = "farewell";
+    for (size_t i = 0; i + sizeof(word) - 1 <= s.size(); ++i) {
+        size_t j = 0;
+        while (j < sizeof(word) - 1 && std::tolower(static_cast<unsigned char>(s[i + j])) == word[j]) ++j;
+        if (j == sizeof(word) - 1) return true;
+    }
+    return false;
+}
+
+bool parseWorldText(std::istream& in, WorldBuilder& builder, std::string& error) {
+    enum class Section { None, World, Room, Npc, Item, Recipe, Rule, Event };
+
+    struct PendingExit { RoomId from; Symbol direction; std::string to; bool locked; int line; };
+    struct PendingNpc { RoomId room; std::string npc; int line; };
+    struct PendingStop { uint32_t npc; std::string room; uint32_t stay; int line; };
+    struct PendingGoto { uint32_t option; std::string node; int line; }; // node is "npc/name"
+    struct ItemText { std::string description, use; };
+    struct PendingRule {
+        std::string room; // empty for any room
+        std::vector<Symbol> triggers;
+        std::vector<RuleOp> tests, effects;
+        std::vector<std::string> says; // text of each RuleSay effect, in order
+        int line;
+    };
+    struct PendingEvent {
+        std::string region; // empty for any region
+        uint32_t period = 0;
+        std::string text;
+        std::vector<RuleOp> tests;
+        int line;
+    };
+
+    Section section = Section::None;
+    RoomId room = kNoRoom;
+    uint32_t npc = kNoNpc;
+    uint32_t node = kNoNode; // dialogue node options are being added to
+    std::string npcKey;
+    Symbol item = kNoSymbol;
+    uint32_t recipe = 0;
+    int recipeLine = 0; // header of the recipe being read, 0 once it has an input
+    std::string start;
+    std::vector<PendingExit> exits;
+    std::vector<PendingNpc> placements;
+    std::vector<PendingStop> stops;
+    std::unordered_map<std::string, uint32_t> npcs;
+    std::vector<std::pair<Symbol, ItemText>> items;
+    std::vector<PendingRule> rules;
+    std::vector<PendingEvent> events;
+    std::unordered_map<std::string, uint32_t> regions;
+    std::unordered_map<std::string, uint32_t> nodes; // "npc/name" -> node
+    std::vector<PendingGoto> gotos;
+
+    std::string raw;
+    int lineNo = 0;
+    auto fail = [&](const std::string& message) {
+        error = "line " + std::to_string(lineNo) + ": " + message;
+        return false;
+    };
+
+    while (std::getline(in, raw)) {
+        ++lineNo;
+        std::string_view line = trim(raw);
+        if (line.empty() || line.front() == '#') continue;
+
+        if (line.front() == '[') {
+            if (recipeLine != 0) {
+                lineNo = recipeLine;
+                return fail("recipe has no inputs");
+            }
+            if (line.back() != ']') return fail("unterminated section header");
+            std::string_view header = trim(line.substr(1, line.size() - 2));
+            size_t space = header.find(' ');
+            std::string_view kind = header.substr(0, space);
+            std::string_view key = space == std::string_view::npos ? std::string_view{}
+                                                                   : trim(header.substr(space));
+            if (kind == "world") {
+                section = Section::World;
+            } else if (key.empty()) {
+                return fail("section needs a name");
+            } else if (kind == "room") {
+                if (builder.findRoom(key) != kNoRoom) return fail("room defined twice");
+                section = Section::Room;
+                room = builder.addRoom(key, key, {});
+            } else if (kind == "npc") {
+                section = Section::Npc;
+                npc = builder.addNpc(intern(key), {});
+                npcs[std::string(key)] = npc;
+                node = builder.npcStartNode(npc);
+                npcKey = std::string(key);
+            } else if (kind == "item") {
+                section = Section::Item;
+                item = intern(key);
+                items.push_back({item, {}});
+            } else if (kind == "rule") {
+                section = Section::Rule;
+                rules.push_back({});
+                rules.back().line = lineNo;
+            } else if (kind == "event") {
+                section = Section::Event;
+                events.push_back({});
+                events.back().line = lineNo;
+            } else if (kind == "recipe") {
+                section = Section::Recipe;
+                recipe = builder.addRecipe(intern(key));
+                recipeLine = lineNo;
+            } else {
+                return fail("unknown section '" + std::string(kind) + "'");
+            }
+            continue;
+        }
+
+        size_t colon = line.find(':');
+        if (colon == std::string_view::npos) return fail("expected 'key: value'");
+        std::string_view key = trim(line.substr(0, colon));
+        std::string_view value = trim(line.substr(colon + 1));
+        std::vector<std::string_view> f = fields(value);
+
+        switch (section) {
+        case Section::None:
+            return fail("value outside of any section");
+        case Section::World:
+            if (key == "start") {
+                start = std::string(value);
+            } else if (key == "map") {
+                // Keep the indentation: drop only the one space after the colon
+                std::string_view rest = std::string_view(raw).substr(raw.find(':') + 1);
+                if (!rest.empty() && rest.front() == ' ') rest.remove_prefix(1);
+                while (!rest.empty() && (rest.back() == ' ' || rest.back() == '\r')) rest.remove_suffix(1);
+                builder.addMapLine(rest);
+            } else {
+                return fail("unknown world key '" + std::string(key) + "'");
+            }
+            break;
+        case Section::Room:
+            if (key == "name") builder.setRoomName(room, value);
+            else if (key == "label") builder.setRoomLabel(room, value);
+            else if (key == "description") builder.setRoomDescription(room, value);
+            else if (key == "item") builder.addItem(room, intern(value));
+            else if (key == "poi" && f.size() == 2) builder.addPointOfInterest(room, intern(f[0]), f[1]);
+            else if (key == "action" && f.size() <= 2) builder.addAction(room, intern(f[0]), f.size() == 2 ? f[1] : std::string_view{});
+            else if (key == "exit" && (f.size() == 2 || (f.size() == 3 && f[2] == "locked")))
+                exits.push_back({room, intern(f[0]), std::string(f[1]), f.size() == 3, lineNo});
+            else if (key == "npc") placements.push_back({room, std::string(value), lineNo});
+            else if (key == "region" && !value.empty()) {
+                const uint32_t region = builder.addRegion(value);
+                regions.emplace(std::string(value), region);
+                builder.setRoomRegion(room, region);
+            }
+            else return fail("bad room entry '" + std::string(key) + "'");
+            break;
+        case Section::Npc:
+            if (key == "greeting") {
+                builder.setNpcGreeting(npc, value);
+            } else if (key == "node" && !value.empty()) {
+                auto added = nodes.emplace(npcKey + "/" + std::string(value), kNoNode);
+                if (!added.second) return fail("node defined twice");
+                node = added.first->second = builder.addDialogueNode();
+            } else if (key == "text") {
+                builder.setDialogueNodeText(node, value);
+            } else if (key == "schedule") {
+                // "ruins 12 | meadow 8": a room and how many ticks to stay
+                for (std::string_view stop : f) {
+                    const size_t space = stop.rfind(' ');
+                    const std::string_view ticks = space == std::string_view::npos ? std::string_view{}
+                                                                                   : stop.substr(space + 1);
+                    uint32_t stay = 0;
+                    for (char c : ticks) {
+                        if (c < '0' || c > '9' || stay > 100000) return fail("bad count '" + std::string(ticks) + "'");
+                        stay = stay * 10 + static_cast<uint32_t>(c - '0');
+                    }
+                    if (stay == 0) return fail("schedule stops are 'room ticks', with ticks at least 1");
+                    stops.push_back({npc, std::string(trim(stop.substr(0, space))), stay, lineNo});
+                }
+            } else if (key == "option" && f.size() >= 2) {
+                // Anything after the reply says where the option leads and
+                // what it needs or does: "end", "goto <node>" or a rule step
+                const uint32_t option = builder.addDialogueOption(node, f[0], f[1]);
+                for (size_t i = 2; i < f.size(); ++i) {
+                    const size_t space = f[i].find(' ');
+                    const std::string_view word = f[i].substr(0, space);
+                    const std::string_view arg = space == std::string_view::npos ? std::string_view{}
+                                                                                 : trim(f[i].substr(space));
+                    RuleOp op;
+                    if (f[i] == "end") {
+                        builder.setOptionTarget(option, kNoNode);
+                    } else if (word == "goto" && !arg.empty()) {
+                        gotos.push_back({option, npcKey + "/" + std::string(arg), lineNo});
+                    } else if (parseStep(word, arg, builder, op)) {
+                        if (op.kind >= kFirstRuleEffect) builder.addOptionEffect(option, static_cast<RuleOpKind>(op.kind), op.arg);
+                        else builder.addOptionTest(option, static_cast<RuleOpKind>(op.kind), op.arg);
+                    } else {
+                        return fail("bad option directive '" + std::string(f[i]) + "'");
+                    }
+                }
+                // Older worlds have no "end": their farewells end the conversation
+                if (f.size() == 2 && containsFarewell(f[0])) builder.setOptionTarget(option, kNoNode);
+            } else {
+                return fail("bad npc entry '" + std::string(key) + "'");
+            }
+            break;
+        case Section::Item:
+            if (key == "description") items.back().second.description = std::string(value);
+            else if (key == "use") items.back().second.use = std::string(value);
+            else return fail("bad item entry '" + std::string(key) + "'");
+            break;
+        case Section::Rule: {
+            PendingRule& rule = rules.back();
+            if (key == "room") {
+                rule.room = std::string(value);
+            } else if (key == "on") {
+                for (std::string_view phrase : f) {
+                    if (phrase.empty()) return fail("empty trigger");
+                    rule.triggers.push_back(intern(phrase));
+                }
+            } else if (key == "say") {
+                rule.effects.push_back({RuleSay, 0, {}});
+                rule.says.emplace_back(value);
+            } else {
+                RuleOp op;
+                if (!parseStep(key, value, builder, op)) return fail("bad rule entry '" + std::string(key) + "'");
+                (op.kind >= kFirstRuleEffect ? rule.effects : rule.tests).push_back(op);
+            }
+            break;
+        }
+        case Section::Event: {
+            PendingEvent& event = events.back();
+            RuleOp op;
+            if (key == "region") {
+                event.region = std::string(value);
+            } else if (key == "every") {
+                uint32_t ticks = 0;
+                for (char c : value) {
+                    if (c < '0' || c > '9' || ticks > 100000) return fail("bad count '" + std::string(value) + "'");
+                    ticks = ticks * 10 + static_cast<uint32_t>(c - '0');
+                }
+                if (ticks == 0) return fail("count must be at least 1");
+                event.period = ticks;
+            } else if (key == "say") {
+                event.text = std::string(value);
+            } else if (parseStep(key, value, builder, op) && op.kind < kFirstRuleEffect) {
+                event.tests.push_back(op);
+            } else {
+                return fail("bad event entry '" + std::string(key) + "'");
+            }
+            break;
+        }
+        case Section::Recipe: {
+            uint32_t count = 1;
+            if ((key == "input" && f.size() == 2) || key == "yield") {
+                const std::string_view n = key == "yield" ? value : f[1];
+                count = 0;
+                for (char c : n) {
+                    if (c < '0' || c > '9' || count > 100000) return fail("bad count '" + std::string(n) + "'");
+                    count = count * 10 + static_cast<uint32_t>(c - '0');
+                }
+                if (count == 0) return fail("count must be at least 1");
+            }
+            if (key == "input" && f.size() <= 2 && !f[0].empty()) {
+                builder.addRecipeInput(recipe, intern(f[0]), count);
+                recipeLine = 0;
+            } else if (key == "yield") builder.setRecipeYield(recipe, count);
+            else if (key == "text") builder.setRecipeText(recipe, value);
+            else return fail("bad recipe entry '" + std::string(key) + "'");
+            break;
+        }
+        }
+    }
+
+    if (recipeLine != 0) {
+        lineNo = recipeLine;
+        return fail("recipe has no inputs");
+    }
+
+    // Resolve references now that every room and NPC is known
+    for (const PendingExit& e : exits) {
+        RoomId to = builder.findRoom(e.to);
+        if (to == kNoRoom) {
+            lineNo = e.line;
+            return fail("exit leads to unknown room '" + e.to + "'");
+        }
+        builder.addExit(e.from, e.direction, to, e.locked);
+    }
+    for (const PendingNpc& p : placements) {
+        auto it = npcs.find(p.npc);
+        if (it == npcs.end()) {
+            lineNo = p.line;
+            return fail("unknown npc '" + p.npc + "'");
+        }
+        builder.placeNpc(p.room, it->second);
+    }
+    for (const PendingStop& stop : stops) {
+        const RoomId to = builder.findRoom(stop.room);
+        if (to == kNoRoom) {
+            lineNo = stop.line;
+            return fail("schedule names unknown room '" + stop.room + "'");
+        }
+        builder.addScheduleStop(stop.npc, to, stop.stay);
+    }
+    for (const PendingGoto& g : gotos) {
+        auto it = nodes.find(g.node);
+        if (it == nodes.end()) {
+            lineNo = g.line;
+            return fail("unknown dialogue node '" + g.node.substr(g.node.find('/') + 1) + "'");
+        }
+        builder.setOptionTarget(g.option, it->second);
+    }
+    for (const auto& i : items) builder.setItemInfo(i.first, i.second.description, i.second.use);
+    for (const PendingRule& r : rules) {
+        lineNo = r.line;
+        const RoomId ruleRoom = r.room.empty() ? kNoRoom : builder.findRoom(r.room);
+        if (!r.room.empty() && ruleRoom == kNoRoom) return fail("rule in unknown room '" + r.room + "'");
+        if (r.triggers.empty()) return fail("rule has no 'on' trigger");
+        for (Symbol trigger : r.triggers) {
+            const uint32_t id = builder.addRule(ruleRoom, trigger);
+            for (const RuleOp& t : r.tests) builder.addRuleTest(id, static_cast<RuleOpKind>(t.kind), t.arg);
+            size_t say = 0;
+            for (const RuleOp& e : r.effects)
+                builder.addRuleEffect(id, static_cast<RuleOpKind>(e.kind), e.arg,
+                                      e.kind == RuleSay ? std::string_view(r.says[say++]) : std::string_view{});
+        }
+    }
+
+    for (const PendingEvent& e : events) {
+        lineNo = e.line;
+        auto region = regions.find(e.region);
+        if (!e.region.empty() && region == regions.end()) return fail("event in unknown region '" + e.region + "'");
+        if (e.period == 0 || e.text.empty()) return fail("event needs 'every' and 'say'");
+        const uint32_t id = builder.addEvent(e.region.empty() ? kNoRegion : region->second, e.period, e.text);
+        for (const RuleOp& t : e.tests) builder.addEventTest(id, static_cast<RuleOpKind>(t.kind), t.arg);
+    }
+
+    if (builder.roomCount() == 0) {
+        error = "world has no rooms";
+        return false;
+    }
+    if (!start.empty()) {
+        RoomId s = builder.findRoom(start);
+        if (s == kNoRoom) {
+            error = "start room '" + start + "' is not defined";
+            return false;
+        }
+        builder.setStartRoom(s);
+    }
+    return true;
+}
+
+std::shared_ptr<const char> mapFile(const std::string& path, size_t& size,
+                                           std::string& error) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "cannot open " + path;
+        return nullptr;
+    }
+    LARGE_INTEGER length;
+    GetFileSizeEx(file, &length);
+    size = static_cast<size_t>(length.QuadPart);
+    HANDLE mapping = size ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(file);
+    if (!mapping) {
+        error = "cannot map " + path;
+        return nullptr;
+    }
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        error = "cannot map " + path;
+        return nullptr;
+    }
+    return std::shared_ptr<const char>(static_cast<const char*>(view),
+                                       [](const char* p) { UnmapViewOfFile(p); });
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path;
+        return nullptr;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        error = "cannot read " + path;
+        return nullptr;
+    }
+    size = static_cast<size_t>(st.st_size);
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        error = "cannot map " + path;
+        return nullptr;
+    }
+    const size_t length = size;
+    return std::shared_ptr<const char>(static_cast<const char*>(view),
+                                       [length](const char* p) { ::munmap(const_cast<char*>(p), length); });
+#endif
+}
+
+bool loadWorld(const std::string& path, World& world, std::string& error) {
+    size_t size = 0;
+    std::shared_ptr<const char> bytes = mapFile(path, size, error);
+    if (!bytes) return false;
+
+    if (size >= sizeof(kImageMagic) &&
+        std::memcmp(bytes.get(), kImageMagic, sizeof(kImageMagic)) == 0) {
+        if (!openWorldImage(std::move(bytes), size, world, error)) {
+            error = path + ": " + error;
+            return false;
+        }
+        world.mapped = true;
+        return true;
+    }
+
+    std::ifstream in(path);
+    WorldBuilder builder;
+    if (!parseWorldText(in, builder, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    if (!builder.build(world, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+bool writeWorldImage(const std::string& path, const std::vector<char>& image,
+                     std::string& error) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(image.data(), static_cast<std::streamsize>(image.size()));
+    if (!out) {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+bool compileWorld(const std::string& textPath, const std::string& imagePath,
+                  std::string& error) {
+    std::ifstream in(textPath);
+    if (!in) {
+        error = "cannot open " + textPath;
+        return false;
+    }
+    WorldBuilder builder;
+    if (!parseWorldText(in, builder, error)) {
+        error = textPath + ": " + error;
+        return false;
+    }
+    return writeWorldImage(imagePath, builder.buildImage(), error);
+}
+
+bool openBuiltinWorld(World& world, std::string& error) {
+    // Nothing to free: the bytes are part of the program
+    std::shared_ptr<const char> image(reinterpret_cast<const char*>(kCampaignImage), [](const char*) {});
+    if (!openWorldImage(std::move(image), kCampaignImageSize, world, error)) {
+        error = "built-in campaign: " + error;
+        return false;
+    }
+    return true;
+}
+
+bool bakeWorld(const std::string& textPath, const std::string& sourcePath,
+               std::string& error) {
+    std::ifstream in(textPath);
+    if (!in) {
+        error = "cannot open " + textPath;
+        return false;
+    }
+    WorldBuilder builder;
+    if (!parseWorldText(in, builder, error)) {
+        error = textPath + ": " + error;
+        return false;
+    }
+    const std::vector<char> image = builder.buildImage();
+
+    std::ofstream out(sourcePath, std::ios::trunc);
+    out << "// The world image of " << textPath << ", written by \"vale --bake\". Don't edit it by\n"
+        << "// hand; bake the world again after changing it.\n"
+        << "#include \"campaign.h\"\n\n"
+        << "// Sections in the image are aligned to 8 bytes from its start\n"
+        << "alignas(8) const unsigned char kCampaignImage[] = {\n";
+    char hex[8];
+    for (size_t i = 0; i < image.size(); ++i) {
+        std::snprintf(hex, sizeof(hex), "0x%02x,", static_cast<unsigned char>(image[i]));
+        out << (i % 16 == 0 ? "    " : " ") << hex << (i % 16 == 15 || i + 1 == image.size() ? "\n" : "");
+    }
+    out << "};\n"
+        << "const size_t kCampaignImageSize = sizeof(kCampaignImage);\n";
+    if (!out) {
+        error = "cannot write " + sourcePath;
+        return false;
+    }
+    return true;
+}
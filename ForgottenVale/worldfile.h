@@ -0,0 +1,109 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "world.h"
+
+// Text world format. Blank lines and lines starting with '#' are ignored.
+// Each section starts with a header line and is followed by "key: value"
+// lines; values with several fields separate them with '|'.
+//
+//   [world]
+//   start: glade                  room the player starts in
+//   map:      [Hill]--[Glade]     one line of the ASCII map, indentation kept
+//
+//   [room glade]
+//   name: Forest Glade
+//   label: Glade                  marked on the map as [Glade]
+//   description: You stand within a quiet glade...
+//   item: flower                  one line per item lying here
+//   poi: oak | The ancient oak is etched with weathered runes.
+//   action: rest | You rest for a moment...
+//   exit: north | river           exit: up | vault | locked
+//   npc: hermit                   one line per NPC living here
+//   region: lowlands              rooms in a region share its weather
+//
+//   [npc hermit]
+//   greeting: An old hermit smiles faintly.
+//   option: Who are you? | Just a wanderer who listens to the vale.
+//   option: Any work? | Find my dog. | set dog quest | goto dog
+//   option: Farewell | The hermit nods. | end
+//   node: dog                     options below belong to this node
+//   text: He whistles hopefully.  shown on arriving, may be left out
+//   option: I found him! | Bless you! | carrying dog | take dog | end
+//   schedule: ruins 12 | meadow 8
+//                                 loops between rooms: 12 ticks in the
+//                                 ruins, then 8 in the meadow. NPCs
+//                                 without one stay in the room that
+//                                 names them.
+//
+// A conversation starts at the greeting. Choosing an option shows its reply
+// and, unless a directive after the reply says otherwise, offers the same
+// options again. Directives are "end", "goto <node>" and any rule test or
+// effect below written as "<key> <value>"; options whose tests fail are not
+// offered. An option without directives whose prompt mentions "farewell"
+// ends the conversation, as in worlds written before nodes existed.
+//
+//   [item flower]
+//   description: A delicate wildflower with a pleasant scent.
+//   use: You inhale the sweet scent of the flower.
+//
+//   [recipe torch]                makes a torch
+//   input: branch
+//   input: cloth | 2              two of them
+//   yield: 1                      how many it makes, 1 if left out
+//   text: You craft a torch.
+//
+//   [rule tower door]             scripted behaviour; the name is only a label
+//   room: tower                   leave out to apply in every room
+//   on: unlock door | open door   room actions or whole typed phrases
+//   locked: up                    tests, all of which must hold:
+//   carrying: rusty key             carrying/lacking an item, flag/unless a
+//                                   flag is set, an exit locked/open
+//   unlock: up                    effects, run in order: unlock/lock an exit,
+//   say: The key turns.             give/take an item, set/clear a flag, say
+//
+// When the player does something with rules, the first rule for that room
+// whose tests hold runs; if none does, rules for any room are tried, and
+// then the ordinary behaviour. Flags start clear.
+//
+//   [event tower wind]            a timed event; the name is only a label
+//   region: tower                 leave out to happen in every region
+//   every: 12                     world ticks (commands) between showings
+//   unless: tower lit             rule tests, all of which must hold
+//   say: Wind moans through the arrow slits.
+//
+// Every command is one world tick. An event shows its text on each tick
+// that is a multiple of its period while the player is in its region.
+// Rooms, NPCs and regions may be referred to before they are defined.
+
+// Reads a text world into builder. Returns false and sets error to a message
+// naming the offending line if the input is malformed.
+bool parseWorldText(std::istream& in, WorldBuilder& builder, std::string& error);
+
+// Maps a whole file read-only. The returned pointer unmaps it when the last
+// copy is released; on failure it is null and error says why.
+std::shared_ptr<const char> mapFile(const std::string& path, size_t& size, std::string& error);
+
+// Opens a world file. Binary images are memory-mapped and used in place;
+// anything else is parsed as the text format and built in memory.
+bool loadWorld(const std::string& path, World& world, std::string& error);
+
+bool writeWorldImage(const std::string& path, const std::vector<char>& image,
+                     std::string& error);
+
+// Parses a text world and writes it out as a binary image
+bool compileWorld(const std::string& textPath, const std::string& imagePath,
+                  std::string& error);
+
+// Opens the built-in campaign compiled into the program (see campaign.h). It
+// is used in place like a mapped image, without reading or parsing anything.
+bool openBuiltinWorld(World& world, std::string& error);
+
+// Parses a text world and writes its image out as C++ source defining
+// kCampaignImage, to be built into the program as the built-in campaign
+bool bakeWorld(const std::string& textPath, const std::string& sourcePath,
+               std::string& error);